@@ -48,7 +48,9 @@
 #include <QUdpSocket>
 #include <QMessageBox>
 
+#include <QJsonArray>
 #include <QJsonDocument>
+#include <QJsonObject>
 
 #include <storage/agentinfo.h>
 #include <storage/phoneinfo.h>
@@ -60,6 +62,7 @@
 #include "ipbxlistener.h"
 #include "xivoconsts.h"
 #include "baseengine.h"
+#include "cti_frame_reader.h"
 #include "cti_server.h"
 #include "phonenumber.h"
 #include "message_factory.h"
@@ -88,16 +91,20 @@ static const QStringList GenLists = (QStringList()
                                      << "queues"
                                      << "voicemails"
                                      << "queuemembers");
+// Maximum number of ids requested in one batched getlist message
+static const int GetlistBatchSize = 500;
 static CTIServer * m_cti_server;
 
 BaseEngine::BaseEngine(QSettings *settings, const QString &osInfo)
     : QObject(NULL),
       m_sessionid(""),
       m_state(ENotLogged),
+      m_initialized(false),
       m_pendingkeepalivemsg(0),
       m_logfile(NULL),
       m_attempt_loggedin(false),
-      m_forced_to_disconnect(false)
+      m_forced_to_disconnect(false),
+      m_getlist_batch(false)
 {
     settings->setParent(this);
     m_timerid_keepalive = 0;
@@ -112,6 +119,10 @@ BaseEngine::BaseEngine(QSettings *settings, const QString &osInfo)
     m_xinfoList.insert("queues", newXInfo<QueueInfo>);
     m_xinfoList.insert("voicemails", newXInfo<VoiceMailInfo>);
     m_xinfoList.insert("queuemembers", newXInfo<QueueMemberInfo>);
+    // lists are only ever cleared, so that XInfoList views stay valid
+    foreach (const QString &listname, GenLists) {
+        m_anylist[listname].clear();
+    }
 
     // TCP connection with CTI Server
     m_ctiserversocket = new QSslSocket(this);
@@ -132,17 +143,25 @@ BaseEngine::BaseEngine(QSettings *settings, const QString &osInfo)
 
     connect(&m_init_watcher, SIGNAL(watching()),
             this, SIGNAL(initializing()));
+    connect(&m_init_watcher, SIGNAL(sawAll()),
+            this, SLOT(setInitialized()));
     connect(&m_init_watcher, SIGNAL(sawAll()),
             this, SIGNAL(initialized()));
+    connect(&m_init_watcher, SIGNAL(progress(int, int)),
+            this, SIGNAL(initializationProgress(int, int)));
 
     connect(m_cti_server, SIGNAL(failedToConnect(const QString &, const QString &, const QString &)),
             this, SIGNAL(doneConnecting()));
     connect(this, SIGNAL(initialized()),
             this, SIGNAL(doneConnecting()));
 
-    connect(this, SIGNAL(updateUserStatus(const QString &)),
+    connect(this, SIGNAL(updateUserStatus(const QString &, quint32)),
             this, SLOT(updatePresence(const QString &)));
 
+    m_status_coalescer.setInterval(m_config["statusframebudget"].toUInt());
+    connect(&m_status_coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)),
+            this, SLOT(emitCoalescedUpdates(const QString &, const QSet<QString> &, quint32)));
+
     if (m_config["autoconnect"].toBool())
         start();
     setupTranslation();
@@ -236,6 +255,7 @@ void BaseEngine::loadSettings()
         m_config["trytoreconnect"] = m_settings->value("trytoreconnect", false).toBool();
         m_config["trytoreconnectinterval"] = m_settings->value("trytoreconnectinterval", 20*1000).toUInt();
         m_config["keepaliveinterval"] = m_settings->value("keepaliveinterval", 120*1000).toUInt();
+        m_config["statusframebudget"] = m_settings->value("statusframebudget", 0).toUInt();
         m_availstate = m_settings->value("availstate", "available").toString();
         m_config["displayprofile"] = m_settings->value("displayprofile", false).toBool();
 
@@ -334,6 +354,7 @@ void BaseEngine::saveSettings()
         m_settings->setValue("trytoreconnect", m_config["trytoreconnect"].toBool());
         m_settings->setValue("trytoreconnectinterval", m_config["trytoreconnectinterval"].toUInt());
         m_settings->setValue("keepaliveinterval", m_config["keepaliveinterval"].toUInt());
+        m_settings->setValue("statusframebudget", m_config["statusframebudget"].toUInt());
         m_settings->setValue("displayprofile", m_config["displayprofile"].toBool());
 
         m_settings->setValue("switchboard.queue", m_config["switchboard_queue_name"].toString());
@@ -427,6 +448,7 @@ void BaseEngine::emitLogged()
 
 void BaseEngine::connected()
 {
+    m_frame_reader.clear();
     if (!m_cti_server->useStartTls()) {
         this->authenticate();
     }
@@ -526,6 +548,11 @@ void BaseEngine::onCTIServerDisconnected()
 void BaseEngine::clearLists()
 {
     emit clearingCache();
+    m_initialized = false;
+    m_watched_agent_id.clear();
+    m_watched_queue_id.clear();
+    m_status_coalescer.clear();
+    m_index.clear();
     foreach (QString listname, m_anylist.keys()) {
         QHashIterator<QString, XInfo *> iter = QHashIterator<QString, XInfo *>(m_anylist.value(listname));
         while (iter.hasNext()) {
@@ -552,6 +579,7 @@ void BaseEngine::deleteTranslators()
         QTranslator * translator_to_delete = m_translators.takeLast();
         delete translator_to_delete;
     }
+    m_translation_paths.clear();
 }
 
 /*! \brief gets m_capaxlets */
@@ -640,34 +668,44 @@ QString BaseEngine::timeElapsed(double timestamp) const
     }
 }
 
+const QHash<QString, XInfo *> & BaseEngine::xinfoList(const QString &listname) const
+{
+    static const QHash<QString, XInfo *> empty_list;
+    QHash<QString, QHash<QString, XInfo *> >::const_iterator list = m_anylist.constFind(listname);
+    if (list == m_anylist.constEnd()) {
+        return empty_list;
+    }
+    return list.value();
+}
+
 const UserInfo * BaseEngine::user(const QString & id) const
 {
-    return static_cast<const UserInfo *> (m_anylist.value("users").value(id));
+    return static_cast<const UserInfo *> (xinfoList("users").value(id));
 }
 
 const PhoneInfo * BaseEngine::phone(const QString & id) const
 {
-    return static_cast<const PhoneInfo *> (m_anylist.value("phones").value(id));
+    return static_cast<const PhoneInfo *> (xinfoList("phones").value(id));
 }
 
 const AgentInfo * BaseEngine::agent(const QString & id) const
 {
-    return static_cast<const AgentInfo *> (m_anylist.value("agents").value(id));
+    return static_cast<const AgentInfo *> (xinfoList("agents").value(id));
 }
 
 const QueueInfo * BaseEngine::queue(const QString & id) const
 {
-    return static_cast<const QueueInfo *> (m_anylist.value("queues").value(id));
+    return static_cast<const QueueInfo *> (xinfoList("queues").value(id));
 }
 
 const VoiceMailInfo * BaseEngine::voicemail(const QString & id) const
 {
-    return static_cast<const VoiceMailInfo *> (m_anylist.value("voicemails").value(id));
+    return static_cast<const VoiceMailInfo *> (xinfoList("voicemails").value(id));
 }
 
 const QueueMemberInfo * BaseEngine::queuemember(const QString & id) const
 {
-    return static_cast<const QueueMemberInfo *> (m_anylist.value("queuemembers").value(id));
+    return static_cast<const QueueMemberInfo *> (xinfoList("queuemembers").value(id));
 }
 
 void BaseEngine::emitMessage(const QString & msg)
@@ -679,20 +717,21 @@ void BaseEngine::emitMessage(const QString & msg)
 void BaseEngine::parseCommand(const QByteArray &raw)
 {
     m_pendingkeepalivemsg = 0;
-    QVariant data = parseJson(raw);
+    QJsonDocument document = QJsonDocument::fromJson(raw);
     bool command_processed = true;
 
-    if (data.isNull()) {
+    if (! document.isObject()) {
         qDebug() << "Invalid json aborting";
         return;
     }
 
-    QVariantMap datamap = data.toMap();
-    QString function = datamap.value("function").toString();
-    QString thisclass = datamap.value("class").toString();
+    // only look at the top level keys until we know what to do with the message
+    QJsonObject message = document.object();
+    QString function = message.value("function").toString();
+    QString thisclass = message.value("class").toString();
 
-    if (datamap.contains("timenow")) {
-        m_timesrv = datamap.value("timenow").toDouble();
+    if (message.contains("timenow")) {
+        m_timesrv = message.value("timenow").toDouble();
         m_timeclt = QDateTime::currentDateTime();
     }
 
@@ -700,6 +739,16 @@ void BaseEngine::parseCommand(const QByteArray &raw)
         // ack from the keepalive and availstate commands previously sent
         return;
     }
+    if (thisclass == "getlist" && function == "updatestatus") {
+        this->handleGetlistUpdateStatus(message);
+        // the whole message is only converted when a listener wants it
+        if (m_listeners.contains(thisclass)) {
+            this->forwardToListeners(thisclass, message.toVariantMap());
+        }
+        return;
+    }
+
+    QVariantMap datamap = message.toVariantMap();
     if (thisclass == "starttls") {
         if (datamap.contains("starttls")) {
             bool starttls = datamap["starttls"].toBool();
@@ -803,6 +852,8 @@ void BaseEngine::parseCommand(const QByteArray &raw)
 
         m_appliname = datamap.value("appliname").toString();
         m_capaxlets = datamap.value("capaxlets").toList();
+        // servers that do not know about batched getlist do not send this key
+        m_getlist_batch = datamap.value("getlist_batch", false).toBool();
 
         QVariantMap capas = datamap.value("capas").toMap();
         m_options_userstatus = capas.value("userstatus").toMap();
@@ -875,21 +926,32 @@ void BaseEngine::addConfigs(const QString &listname, const QString &ipbxid, cons
     if (! GenLists.contains(listname)) {
         return;
     }
+    QHash<QString, XInfo *> &list = m_anylist[listname];
     foreach (const QString &id, listid) {
-        QString xid = QString("%1/%2").arg(ipbxid).arg(id);
-        if (! m_anylist[listname].contains(xid)) {
-            newXInfoProto construct = m_xinfoList.value(listname);
-            XInfo * xinfo = construct(ipbxid, id);
-            m_anylist[listname][xid] = xinfo;
+        if (! list.contains(XInfo::makeXid(ipbxid, id))) {
+            createXInfo(listname, ipbxid, id);
         }
     }
 }
 
+/*! \brief construct an object of listname and store it under its own xid
+ *
+ * The key of the list shares the string of XInfo::xid() instead of
+ * holding a second copy of it.
+ */
+XInfo * BaseEngine::createXInfo(const QString &listname, const QString &ipbxid, const QString &id)
+{
+    newXInfoProto construct = m_xinfoList.value(listname);
+    XInfo * xinfo = construct(ipbxid, id);
+    m_anylist[listname].insert(xinfo->xid(), xinfo);
+    return xinfo;
+}
+
 void BaseEngine::handleGetlistDelConfig(const QString &listname, const QString &ipbxid, const QStringList &listid)
 {
     // Pre delete actions
     foreach (const QString &id, listid) {
-        QString xid = QString("%1/%2").arg(ipbxid).arg(id);
+        QString xid = XInfo::makeXid(ipbxid, id);
         if (listname == "phones")
             emit removePhoneConfig(xid);
         else if (listname == "users")
@@ -904,12 +966,11 @@ void BaseEngine::handleGetlistDelConfig(const QString &listname, const QString &
 
     // Delete
     foreach (const QString &id, listid) {
-        QString xid = QString("%1/%2").arg(ipbxid).arg(id);
+        QString xid = XInfo::makeXid(ipbxid, id);
         if (GenLists.contains(listname)) {
-            if (m_anylist.value(listname).contains(xid)) {
-                delete m_anylist[listname][xid];
-                m_anylist[listname].remove(xid);
-            }
+            removeFromIndex(listname, xid);
+            m_status_coalescer.forget(listname, xid);
+            delete m_anylist[listname].take(xid);
         }
         if (listname == "queuemembers") {
             if (m_queuemembers.contains(xid)) {
@@ -921,7 +982,7 @@ void BaseEngine::handleGetlistDelConfig(const QString &listname, const QString &
 
     // Post delete
     foreach (const QString &id, listid) {
-        QString xid = QString("%1/%2").arg(ipbxid).arg(id);
+        QString xid = XInfo::makeXid(ipbxid, id);
         if (listname == "queuemembers") {
             emit postRemoveQueueMemberConfig(xid);
         } else if (listname == "queues") {
@@ -936,16 +997,17 @@ void BaseEngine::handleGetlistUpdateConfig(
     const QString &id,
     const QVariantMap &data)
 {
-    QString xid = QString("%1/%2").arg(ipbxid).arg(id);
+    QString xid = XInfo::makeXid(ipbxid, id);
     QVariantMap config = data.value("config").toMap();
+    quint32 fields = 0;
     if (GenLists.contains(listname)) {
-        if (! m_anylist.value(listname).contains(xid)) {
-            newXInfoProto construct = m_xinfoList.value(listname);
-            XInfo * xinfo = construct(ipbxid, id);
-            m_anylist[listname][xid] = xinfo;
+        XInfo * xinfo = xinfoList(listname).value(xid);
+        if (xinfo == NULL) {
+            xinfo = createXInfo(listname, ipbxid, id);
         }
-        if (m_anylist.value(listname).value(xid) != NULL) {
-            m_anylist.value(listname)[xid]->updateConfig(config);
+        if (xinfo != NULL) {
+            fields = xinfo->updateConfig(config);
+            updateIndex(listname, xinfo, fields);
         } else {
             qDebug() << "received updateconfig for inexisting" << listname << xid;
         }
@@ -962,18 +1024,23 @@ void BaseEngine::handleGetlistUpdateConfig(
 
     // transmission to xlets
     if (listname == "users") {
-        emit updateUserConfig(xid);
+        emit updateUserConfig(xid, fields);
         emit updateUserConfig(xid,data);
     } else if (listname == "phones")
-        emit updatePhoneConfig(xid);
+        emit updatePhoneConfig(xid, fields);
     else if (listname == "agents")
-        emit updateAgentConfig(xid);
+        emit updateAgentConfig(xid, fields);
     else if (listname == "queues")
-        emit updateQueueConfig(xid);
+        emit updateQueueConfig(xid, fields);
     else if (listname == "voicemails")
-        emit updateVoiceMailConfig(xid);
-    else if (listname == "queuemembers")
-        emit updateQueueMemberConfig(xid);
+        emit updateVoiceMailConfig(xid, fields);
+    else if (listname == "queuemembers") {
+        emit updateQueueMemberConfig(xid, fields);
+        if (fields != 0) {
+            m_status_coalescer.markDirty(listname, xid, fields);
+        }
+    }
+    m_update_router.route(listname, UpdateRouter::CONFIG, xid, config);
 }
 
 void BaseEngine::handleGetlistUpdateStatus(
@@ -982,13 +1049,19 @@ void BaseEngine::handleGetlistUpdateStatus(
     const QString &id,
     const QVariantMap &status)
 {
-    QString xid = QString("%1/%2").arg(ipbxid).arg(id);
+    QString xid = XInfo::makeXid(ipbxid, id);
 
     m_init_watcher.sawItem(listname, id);
 
+    quint32 fields = 0;
     if (GenLists.contains(listname)) {
-        if (m_anylist.value(listname).contains(xid))
-            m_anylist.value(listname).value(xid)->updateStatus(status);
+        XInfo * xinfo = xinfoList(listname).value(xid);
+        if (xinfo != NULL) {
+            fields = xinfo->updateStatus(status);
+        }
+        if (fields != 0) {
+            updateIndex(listname, xinfo, fields);
+        }
     }
     if (listname == "queuemembers") {
         if (! m_queuemembers.contains(xid))
@@ -997,19 +1070,125 @@ void BaseEngine::handleGetlistUpdateStatus(
     }
 
     if (listname == "users") {
-        emit updateUserStatus(xid);
+        emit updateUserStatus(xid, fields);
     } else if (listname == "phones") {
-        emit updatePhoneStatus(xid);
+        emit updatePhoneStatus(xid, fields);
     } else if (listname == "agents") {
-        emit updateAgentStatus(xid);
+        emit updateAgentStatus(xid, fields);
     } else if (listname == "queues") {
-        emit updateQueueStatus(xid);
+        emit updateQueueStatus(xid, fields);
     } else if (listname == "voicemails")
-        emit updateVoiceMailStatus(xid);
+        emit updateVoiceMailStatus(xid, fields);
+    m_update_router.route(listname, UpdateRouter::STATUS, xid, status);
+
+    // queuemembers statuses are shown through the status of their agent
+    if (listname == "queuemembers") {
+        const QueueMemberInfo *queue_member = this->queuemember(xid);
+        if (queue_member != NULL && (fields & (QueueMemberInfo::FIELD_STATUS | QueueMemberInfo::FIELD_PAUSED))) {
+            QString agent_id = m_index.agentFromNumber(queue_member->agentNumber());
+            if (! agent_id.isEmpty()) {
+                m_status_coalescer.markDirty("agents", agent_id, AgentInfo::FIELD_QUEUES);
+            }
+        }
+    } else if (GenLists.contains(listname) && fields != 0) {
+        m_status_coalescer.markDirty(listname, xid, fields);
+    }
+}
+
+/*! \brief forward a frame of coalesced updates to the models
+ *
+ * The per-xid signals are emitted as the messages arrive, the batched ones
+ * once per frame budget ("statusframebudget" in ms, 0 for every event loop
+ * iteration) so that views can refresh a whole range of rows at once.
+ * fields is the union of the change masks of the frame.
+ */
+void BaseEngine::emitCoalescedUpdates(const QString &listname, const QSet<QString> &xids, quint32 fields)
+{
+    if (listname == "users") {
+        emit updateUserStatuses(xids, fields);
+    } else if (listname == "phones") {
+        emit updatePhoneStatuses(xids, fields);
+    } else if (listname == "agents") {
+        emit updateAgentStatuses(xids, fields);
+    } else if (listname == "queues") {
+        emit updateQueueStatuses(xids, fields);
+    } else if (listname == "voicemails") {
+        emit updateVoiceMailStatuses(xids, fields);
+    } else if (listname == "queuemembers") {
+        emit updateQueueMemberConfigs(xids, fields);
+    }
+}
+
+/*! \brief handle a getlist updatestatus message without converting all of it
+ *
+ * Status updates are most of the CTI traffic, only the status of each
+ * item is converted before being given to its XInfo.
+ */
+void BaseEngine::handleGetlistUpdateStatus(const QJsonObject &message)
+{
+    QString listname = message.value("listname").toString();
+    QString ipbxid = message.value("tipbxid").toString();
+
+    if (message.contains("items")) {
+        // batched reply: one {"tid", "status"} object per requested id
+        foreach (const QJsonValue &item, message.value("items").toArray()) {
+            const QJsonObject &itemobject = item.toObject();
+            this->handleGetlistUpdateStatus(listname, ipbxid,
+                                            itemobject.value("tid").toString(),
+                                            itemobject.value("status").toObject().toVariantMap());
+        }
+    } else {
+        this->handleGetlistUpdateStatus(listname, ipbxid,
+                                        message.value("tid").toString(),
+                                        message.value("status").toObject().toVariantMap());
+    }
+}
+
+void BaseEngine::updateIndex(const QString &listname, const XInfo *xinfo, quint32 fields)
+{
+    if (listname == "agents") {
+        const AgentInfo *agent = static_cast<const AgentInfo *>(xinfo);
+        m_index.updateAgent(agent->xid(), agent->agentNumber());
+    } else if (listname == "phones") {
+        const PhoneInfo *phone = static_cast<const PhoneInfo *>(xinfo);
+        m_index.updatePhone(phone->xid(), phone->identity());
+    } else if (listname == "queues") {
+        const QueueInfo *queue = static_cast<const QueueInfo *>(xinfo);
+        m_index.updateQueue(queue->xid(), queue->queueName());
+    } else if (listname == "queuemembers") {
+        const QueueMemberInfo *queue_member = static_cast<const QueueMemberInfo *>(xinfo);
+        m_index.updateQueueMember(queue_member->xid(),
+                                  queue_member->queueName(),
+                                  queue_member->agentNumber(),
+                                  queue_member->is_agent());
+        if (fields & QueueMemberInfo::FIELD_PAUSED) {
+            m_index.touchQueueMember(queue_member->xid());
+        }
+    }
+}
+
+void BaseEngine::removeFromIndex(const QString &listname, const QString &xid)
+{
+    if (listname == "agents") {
+        m_index.removeAgent(xid);
+    } else if (listname == "phones") {
+        m_index.removePhone(xid);
+    } else if (listname == "queues") {
+        m_index.removeQueue(xid);
+    } else if (listname == "queuemembers") {
+        m_index.removeQueueMember(xid);
+    }
 }
 
 void BaseEngine::requestListConfig(const QString &listname, const QString &ipbxid, const QStringList &listid)
 {
+    if (m_getlist_batch) {
+        for (int i = 0; i < listid.size(); i += GetlistBatchSize) {
+            sendJsonCommand(MessageFactory::getlistUpdateConfig(listname, ipbxid, listid.mid(i, GetlistBatchSize)));
+        }
+        return;
+    }
+
     QVariantMap command;
     command["class"] = "getlist";
     command["function"] = "updateconfig";
@@ -1021,19 +1200,26 @@ void BaseEngine::requestListConfig(const QString &listname, const QString &ipbxi
     }
 }
 
-void BaseEngine::requestStatus(const QString &listname, const QString &ipbxid, const QString &id)
+void BaseEngine::requestStatus(const QString &listname, const QString &ipbxid, const QStringList &listid)
 {
+    if (m_getlist_batch) {
+        for (int i = 0; i < listid.size(); i += GetlistBatchSize) {
+            sendJsonCommand(MessageFactory::getlistUpdateStatus(listname, ipbxid, listid.mid(i, GetlistBatchSize)));
+        }
+        return;
+    }
+
     QVariantMap command;
     command["class"] = "getlist";
     command["function"] = "updatestatus";
     command["listname"] = listname;
     command["tipbxid"] = ipbxid;
-    command["tid"] = id;
-    sendJsonCommand(command);
+    foreach (const QString &id, listid) {
+        command["tid"] = id;
+        sendJsonCommand(command);
+    }
 }
 
-
-
 void BaseEngine::configsLists(const QString & function, const QVariantMap & datamap)
 {
     QString listname = datamap.value("listname").toString();
@@ -1047,13 +1233,21 @@ void BaseEngine::configsLists(const QString & function, const QVariantMap & data
         QStringList listid = datamap.value("list").toStringList();
         this->handleGetlistDelConfig(listname, ipbxid, listid);
     } else if (function == "updateconfig") {
-        QString id = datamap.value("tid").toString();
-        this->handleGetlistUpdateConfig(listname, ipbxid, id, datamap);
-        this->requestStatus(listname, ipbxid, id);
-    } else if (function == "updatestatus") {
-        QString id = datamap.value("tid").toString();
-        QVariantMap status = datamap.value("status").toMap();
-        this->handleGetlistUpdateStatus(listname, ipbxid, id, status);
+        if (datamap.contains("items")) {
+            // batched reply: one {"tid", "config"} map per requested id
+            QStringList listid;
+            foreach (const QVariant &item, datamap.value("items").toList()) {
+                const QVariantMap &itemmap = item.toMap();
+                QString id = itemmap.value("tid").toString();
+                this->handleGetlistUpdateConfig(listname, ipbxid, id, itemmap);
+                listid << id;
+            }
+            this->requestStatus(listname, ipbxid, listid);
+        } else {
+            QString id = datamap.value("tid").toString();
+            this->handleGetlistUpdateConfig(listname, ipbxid, id, datamap);
+            this->requestStatus(listname, ipbxid, QStringList() << id);
+        }
     } else if (function == "addconfig") {
         QStringList listid = datamap.value("list").toStringList();
         this->addConfigs(listname, ipbxid, listid);
@@ -1263,17 +1457,18 @@ void BaseEngine::saveToFile(const QString & filename)
  */
 void BaseEngine::ctiSocketReadyRead()
 {
-    while (m_ctiserversocket->canReadLine()) {
-        QByteArray data  = m_ctiserversocket->readLine();
-        QString line = QString::fromUtf8(data);
+    m_frame_reader.append(m_ctiserversocket->readAll());
 
-        if (line.startsWith("<ui version=")) {
+    QByteArray frame;
+    while (m_frame_reader.nextFrame(&frame)) {
+        if (CTIFrameReader::isUiForm(frame)) {
             // we get here when receiving a sheet as a Qt4 .ui form
-            qDebug() << "Incoming sheet, size:" << line.size();
-            emit displayFiche(line, true, QString());
+            // the frame reader strips the newline that readLine used to keep
+            QString form = QString::fromUtf8(frame).append('\n');
+            qDebug() << "Incoming sheet, size:" << form.size();
+            emit displayFiche(form, true, QString());
         } else {
-            data.chop(1);  // remove the \n the the end of the json
-            parseCommand(data);
+            parseCommand(frame);
         }
     }
 }
@@ -1314,6 +1509,8 @@ void BaseEngine::setConfig(const QVariantMap & qvm)
                            m_config["trytoreconnectinterval"].toUInt() != qvm["trytoreconnectinterval"].toUInt();
     bool reload_keepalive = qvm.contains("keepaliveinterval") &&
                             m_config["keepaliveinterval"].toUInt() != qvm["keepaliveinterval"].toUInt();
+    bool reload_status_frame = qvm.contains("statusframebudget") &&
+                               m_config["statusframebudget"].toUInt() != qvm["statusframebudget"].toUInt();
     bool toggle_presence_enabled = qvm.contains("checked_function.presence") &&
                             m_config["checked_function.presence"].toBool() != qvm["checked_function.presence"].toBool();
 
@@ -1327,6 +1524,9 @@ void BaseEngine::setConfig(const QVariantMap & qvm)
         stopKeepAliveTimer();
         m_timerid_keepalive = startTimer(m_config["keepaliveinterval"].toUInt());
     }
+    if (reload_status_frame) {
+        m_status_coalescer.setInterval(m_config["statusframebudget"].toUInt());
+    }
 
     setUserLogin(m_config["userlogin"].toString());
 
@@ -1459,15 +1659,22 @@ BaseEngine::EngineState BaseEngine::state()
 void BaseEngine::changeWatchedAgent(const QString & agentid, bool force)
 {
     if ((force || (agentid.size() > 0)) && (hasAgent(agentid))) {
+        m_watched_agent_id = agentid;
         emit changeWatchedAgentSignal(agentid);
     }
 }
 
 void BaseEngine::changeWatchedQueue(const QString & queueid)
 {
+    m_watched_queue_id = queueid;
     emit changeWatchedQueueSignal(queueid);
 }
 
+void BaseEngine::setInitialized()
+{
+    m_initialized = true;
+}
+
 /*! \brief sets m_osname
  *
  * also builds a string defining who is the client (osname)
@@ -1541,10 +1748,7 @@ QString BaseEngine::getInitialPresence() const
  * Return NULL if not available */
 UserInfo * BaseEngine::getXivoClientUser()
 {
-    if (m_anylist.value("users").contains(m_xuserid)) {
-        return (UserInfo *) m_anylist.value("users").value(m_xuserid);
-    }
-    return NULL;
+    return (UserInfo *) xinfoList("users").value(m_xuserid);
 }
 
 int BaseEngine::forwardToListeners(QString event_dest, const QVariantMap & map)
@@ -1566,6 +1770,11 @@ void BaseEngine::registerListener(const QString & event_to_listen, IPBXListener
 
 void BaseEngine::registerTranslation(const QString &path)
 {
+    if (m_translation_paths.contains(path)) {
+        return;
+    }
+    m_translation_paths.insert(path);
+
     QString translation_file = path.arg(m_locale);
     QTranslator *translator = this->createTranslator(translation_file);
     m_translators.append(translator);
@@ -35,17 +35,23 @@
 #include <QHash>
 #include <QMultiHash>
 #include <QObject>
+#include <QSet>
 #include <QTime>
 #include <QVector>
 
 #include <storage/init_watcher.h>
 #include <storage/xinfo.h>
+#include <storage/xinfo_index.h>
 
 #include "baseconfig.h"
+#include "cti_frame_reader.h"
+#include "status_coalescer.h"
+#include "update_router.h"
 
 class QApplication;
 class QDateTime;
 class QFile;
+class QJsonObject;
 class QSettings;
 class QSocketNotifier;
 class QSslError;
@@ -102,13 +108,24 @@ class BASELIB_EXPORT BaseEngine: public QObject
 
         const QString & getFullId() const { return m_xuserid; };
         UserInfo * getXivoClientUser();       //!< Return the user of the XiVO CTI Client
+        bool isInitialized() const { return m_initialized; };  //!< all the lists were received since login
+        const QString & watchedAgentId() const { return m_watched_agent_id; };
+        const QString & watchedQueueId() const { return m_watched_queue_id; };
 
         double timeDeltaServerClient() const;
         QString timeElapsed(double) const;
 
-        bool hasAgent(const QString & xid) { return m_anylist.value("agents").contains(xid); };
+        bool hasAgent(const QString & xid) const { return xinfoList("agents").contains(xid); };
 
-        QHash<QString, XInfo *> iterover(const QString & listname) { return m_anylist.value(listname); };
+        XInfoList<UserInfo> users() const { return XInfoList<UserInfo>(xinfoList("users")); };
+        XInfoList<PhoneInfo> phones() const { return XInfoList<PhoneInfo>(xinfoList("phones")); };
+        XInfoList<AgentInfo> agents() const { return XInfoList<AgentInfo>(xinfoList("agents")); };
+        XInfoList<QueueInfo> queues() const { return XInfoList<QueueInfo>(xinfoList("queues")); };
+        XInfoList<VoiceMailInfo> voicemails() const { return XInfoList<VoiceMailInfo>(xinfoList("voicemails")); };
+        XInfoList<QueueMemberInfo> queuemembers() const { return XInfoList<QueueMemberInfo>(xinfoList("queuemembers")); };
+        const XInfoIndex & index() const { return m_index; };
+        //! subscriptions to the updates of single xids
+        UpdateRouter & updateRouter() { return m_update_router; };
 
         const UserInfo * user(const QString & id) const;
         const PhoneInfo * phone(const QString & id) const;
@@ -214,6 +231,9 @@ class BASELIB_EXPORT BaseEngine: public QObject
                         const QString & server_address = "",
                         const QString & server_port = "");
 
+        void emitCoalescedUpdates(const QString &listname, const QSet<QString> &xids, quint32 fields);
+        void setInitialized();
+
         void updatePresence(const QString & user_xid);
 
     signals:
@@ -227,6 +247,7 @@ class BASELIB_EXPORT BaseEngine: public QObject
 
         void initialized();
         void initializing();
+        void initializationProgress(int seen, int total);  //!< items of the initial lists received so far
 
         void emitTextMessage(const QString &);  //!< message to be displayed to the user.
 
@@ -240,18 +261,27 @@ class BASELIB_EXPORT BaseEngine: public QObject
 
         void peersReceived();  //!< list of peer was received
 
-        void updatePhoneConfig(const QString &);
-        void updatePhoneStatus(const QString &);
-        void updateUserConfig(const QString &);
+        // the quint32 is the mask of the XInfo fields changed by the message
+        void updatePhoneConfig(const QString &, quint32);
+        void updatePhoneStatus(const QString &, quint32);
+        void updateUserConfig(const QString &, quint32);
         void updateUserConfig(const QString &, const QVariantMap &);
-        void updateUserStatus(const QString &);
-        void updateAgentConfig(const QString &);
-        void updateAgentStatus(const QString &);
-        void updateQueueConfig(const QString &);
-        void updateQueueStatus(const QString &);
-        void updateVoiceMailConfig(const QString &);
-        void updateVoiceMailStatus(const QString &);
-        void updateQueueMemberConfig(const QString &);
+        void updateUserStatus(const QString &, quint32);
+        void updateAgentConfig(const QString &, quint32);
+        void updateAgentStatus(const QString &, quint32);
+        void updateQueueConfig(const QString &, quint32);
+        void updateQueueStatus(const QString &, quint32);
+        void updateVoiceMailConfig(const QString &, quint32);
+        void updateVoiceMailStatus(const QString &, quint32);
+        void updateQueueMemberConfig(const QString &, quint32);
+        // batched versions of the above, emitted once per status frame with
+        // the union of the masks, for models refreshing only some columns
+        void updatePhoneStatuses(const QSet<QString> &, quint32);
+        void updateUserStatuses(const QSet<QString> &, quint32);
+        void updateAgentStatuses(const QSet<QString> &, quint32);
+        void updateQueueStatuses(const QSet<QString> &, quint32);
+        void updateVoiceMailStatuses(const QSet<QString> &, quint32);
+        void updateQueueMemberConfigs(const QSet<QString> &, quint32);
         void removePhoneConfig(const QString &);
         void removeUserConfig(const QString &);
         void removeAgentConfig(const QString &);
@@ -296,10 +326,16 @@ class BASELIB_EXPORT BaseEngine: public QObject
         void handleGetlistDelConfig(const QString &listname, const QString &ipbxid, const QStringList &ids);
         void handleGetlistUpdateConfig(const QString &listname, const QString &ipbxid, const QString &id, const QVariantMap &data);
         void handleGetlistUpdateStatus(const QString &listname, const QString &ipbxid, const QString &id, const QVariantMap &status);
+        void handleGetlistUpdateStatus(const QJsonObject &message);
         void requestListConfig(const QString &listname, const QString &ipbxid, const QStringList &listid);
-        void requestStatus(const QString &listname, const QString &ipbxid, const QString &id);
+        void requestStatus(const QString &listname, const QString &ipbxid, const QStringList &listid);
         void addConfigs(const QString &listname, const QString &ipbxid, const QStringList &listid);
 
+        const QHash<QString, XInfo *> & xinfoList(const QString &listname) const;
+        XInfo * createXInfo(const QString &listname, const QString &ipbxid, const QString &id);
+        void updateIndex(const QString &listname, const XInfo *xinfo, quint32 fields);
+        void removeFromIndex(const QString &listname, const QString &xid);
+
         void clearLists();
         void clearChannelList();
         void deleteTranslators();
@@ -326,6 +362,7 @@ class BASELIB_EXPORT BaseEngine: public QObject
 
         QString m_locale;
         QList<QTranslator *> m_translators;   //!< Vector of translators
+        QSet<QString> m_translation_paths;    //!< paths given to registerTranslation
 
         // Replies given by the server
         QVariantList m_capaxlets;        //!< List of xlet capabilities issued by the server after a successful login
@@ -337,12 +374,16 @@ class BASELIB_EXPORT BaseEngine: public QObject
 
         // Status variables
         EngineState m_state;            //!< State of the engine (Logged/Not Logged)
+        bool m_initialized;             //!< initialized() was emitted since the lists were cleared
+        QString m_watched_agent_id;     //!< last agent of changeWatchedAgentSignal
+        QString m_watched_queue_id;     //!< last queue of changeWatchedQueueSignal
         QString m_availstate;           //!< Availability state to send to the server
 
         // QSslSocket * m_sslsocket;
 
         // Internal management
         QSslSocket * m_ctiserversocket;     //!< Connection to the CTI server
+        CTIFrameReader m_frame_reader;      //!< splits data from the CTI server in messages
         QTcpSocket * m_tcpsheetsocket;  //!< TCP connection for Sheet sockets
         QUdpSocket * m_udpsheetsocket;  //!< UDP connection for Sheet sockets
         int m_timerid_keepalive;        //!< timer id for keep alive
@@ -357,6 +398,7 @@ class BASELIB_EXPORT BaseEngine: public QObject
 
         bool m_attempt_loggedin;
         bool m_forced_to_disconnect;    //!< set to true when disconnected by server
+        bool m_getlist_batch;           //!< server accepts getlist requests for several ids at once
 
         QMultiHash<QString, IPBXListener*> m_listeners;
 
@@ -364,10 +406,14 @@ class BASELIB_EXPORT BaseEngine: public QObject
         QHash<QString, newXInfoProto> m_xinfoList;  //!< XInfo constructors
         QHash<QString, QHash<QString, XInfo *> > m_anylist;
         QHash<QString, QueueMemberInfo *> m_queuemembers;
+        XInfoIndex m_index;
+        StatusCoalescer m_status_coalescer;                 //!< batches updates for the models
+        UpdateRouter m_update_router;                       //!< per xid updates for the xlets
 
         InitWatcher m_init_watcher;
 
     friend class CTIServer;
+    friend class CTIReplay;
     friend class XletDebug;
 };
 
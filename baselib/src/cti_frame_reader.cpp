@@ -1,5 +1,5 @@
 /* XiVO Client
- * Copyright (C) 2007-2014 Avencall
+ * Copyright (C) 2016 Avencall
  *
  * This file is part of XiVO Client.
  *
@@ -27,37 +27,53 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include <QDebug>
-#include <xletlib/agents_model.h>
+#include "cti_frame_reader.h"
 
-#include "agent_status_sort_filter_proxy_model.h"
+CTIFrameReader::CTIFrameReader()
+    : m_frame_start(0),
+      m_scan_from(0)
+{
+}
 
-AgentStatusSortFilterProxyModel::AgentStatusSortFilterProxyModel(const QString &queue_id, QObject *parent)
-    : AbstractSortFilterProxyModel(parent)
+void CTIFrameReader::append(const QByteArray &data)
 {
-    m_queue_id = queue_id;
+    m_buffer.append(data);
 }
 
-AgentStatusSortFilterProxyModel::~AgentStatusSortFilterProxyModel()
+bool CTIFrameReader::nextFrame(QByteArray *frame)
 {
+    int frame_end = m_buffer.indexOf('\n', m_scan_from);
+    if (frame_end == -1) {
+        m_scan_from = m_buffer.size();
+        // drop the frames already handed out before more data is appended
+        if (m_frame_start > 0) {
+            m_buffer.remove(0, m_frame_start);
+            m_scan_from -= m_frame_start;
+            m_frame_start = 0;
+        }
+        return false;
+    }
+
+    *frame = m_buffer.mid(m_frame_start, frame_end - m_frame_start);
+    m_frame_start = frame_end + 1;
+    m_scan_from = m_frame_start;
+    return true;
 }
 
-bool AgentStatusSortFilterProxyModel::filterAcceptsRow(int source_row, const QModelIndex & source_parent) const
+int CTIFrameReader::pendingSize() const
 {
-    return this->agentInQueue(source_row, source_parent)
-        && this->agentLogged(source_row, source_parent);
+    return m_buffer.size() - m_frame_start;
 }
 
-bool AgentStatusSortFilterProxyModel::agentInQueue(int source_row, const QModelIndex & source_parent) const
+void CTIFrameReader::clear()
 {
-    QModelIndex agent_model_index = this->sourceModel()->index(source_row, AgentsModel::JOINED_QUEUE_LIST, source_parent);
-    QVariantList queue_list = agent_model_index.data().toList();
-    return queue_list.contains(this->m_queue_id);
+    m_buffer.clear();
+    m_frame_start = 0;
+    m_scan_from = 0;
 }
 
-bool AgentStatusSortFilterProxyModel::agentLogged(int source_row, const QModelIndex & source_parent) const
+/*! \brief true when the frame is a sheet sent as a Qt .ui form instead of json */
+bool CTIFrameReader::isUiForm(const QByteArray &frame)
 {
-    QModelIndex agent_model_index = this->sourceModel()->index(source_row, AgentsModel::LOGGED_STATUS, source_parent);
-    bool agent_logged = agent_model_index.data(Qt::UserRole).toBool();
-    return agent_logged;
+    return frame.startsWith("<ui version=");
 }
@@ -0,0 +1,62 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CTI_FRAME_READER_H__
+#define __CTI_FRAME_READER_H__
+
+#include <QByteArray>
+
+#include "baselib_export.h"
+
+/*! \brief Splits the CTI byte stream in newline terminated frames
+ *
+ * Bytes are appended as they are read from the socket and complete frames
+ * are handed out without their newline. Only the bytes received since the
+ * last call are scanned for the delimiter, so a large message arriving in
+ * many small reads is not scanned again on every read.
+ */
+class BASELIB_EXPORT CTIFrameReader
+{
+    public:
+        CTIFrameReader();
+
+        void append(const QByteArray &data);
+        bool nextFrame(QByteArray *frame);
+        int pendingSize() const;
+        void clear();
+
+        static bool isUiForm(const QByteArray &frame);
+
+    private:
+        QByteArray m_buffer;
+        int m_frame_start;  //!< first byte of the next frame to hand out
+        int m_scan_from;    //!< first byte not scanned for a newline yet
+};
+
+#endif
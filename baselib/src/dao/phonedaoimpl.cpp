@@ -68,13 +68,11 @@ QVariantMap PhoneDAOImpl::getPhoneStatusConfig(const PhoneInfo *phone) const
 
 const PhoneInfo *PhoneDAOImpl::findByIdentity(const QString &line_interface) const
 {
-    foreach (const QString & phonexid, b_engine->iterover("phones").keys()) {
-        const PhoneInfo * p = b_engine->phone(phonexid);
-        if (p && p->identity() == line_interface) {
-            return p;
-        }
+    const QString &phone_xid = b_engine->index().phoneFromIdentity(line_interface);
+    if (phone_xid.isEmpty()) {
+        return NULL;
     }
-    return NULL;
+    return b_engine->phone(phone_xid);
 }
 
 const PhoneInfo *PhoneDAOImpl::findByXId(const QString &phone_xid) const
@@ -37,22 +37,14 @@
 
 QString QueueDAO::queueDisplayNameFromQueueName(const QString &queue_name)
 {
-    foreach (const QString &queue_id, b_engine->iterover("queues").keys()) {
-        const QueueInfo * queue = b_engine->queue(queue_id);
-        if (queue != NULL && queue->queueName() == queue_name) {
-            return queue->queueDisplayName();
-        }
+    const QueueInfo *queue = b_engine->queue(b_engine->index().queueFromName(queue_name));
+    if (queue == NULL) {
+        return QString();
     }
-    return QString();
+    return queue->queueDisplayName();
 }
 
 QString QueueDAO::findQueueIdByName(const QString &queue_name)
 {
-    foreach (const QString &queue_id, b_engine->iterover("queues").keys()) {
-        const QueueInfo *queue = b_engine->queue(queue_id);
-        if (queue && queue->queueName() == queue_name) {
-            return queue->xid();
-        }
-    }
-    return QString();
+    return b_engine->index().queueFromName(queue_name);
 }
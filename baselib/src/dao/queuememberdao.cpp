@@ -51,28 +51,12 @@ QStringList QueueMemberDAO::queueListFromAgentId(const QString & agent_id)
 
 QString QueueMemberDAO::queueIdFromQueueName(const QString & queue_name)
 {
-    foreach(const QString &queue_xid, b_engine->iterover("queues").keys()) {
-        const QueueInfo *queueinfo = b_engine->queue(queue_xid);
-        if (queueinfo != NULL) {
-            if (queueinfo->queueName() == queue_name) {
-                return queue_xid;
-            }
-        }
-    }
-    return "";
+    return b_engine->index().queueFromName(queue_name);
 }
 
 QString QueueMemberDAO::agentIdFromAgentNumber(const QString & agent_number)
 {
-    foreach(const QString &agent_id, b_engine->iterover("agents").keys()) {
-        const AgentInfo *agentinfo = b_engine->agent(agent_id);
-        if (agentinfo != NULL) {
-            if (agentinfo->agentNumber() == agent_number) {
-                return agent_id;
-            }
-        }
-    }
-    return "";
+    return b_engine->index().agentFromNumber(agent_number);
 }
 
 QString QueueMemberDAO::agentNumberFromAgentId(const QString & agent_id)
@@ -90,30 +74,18 @@ QString QueueMemberDAO::queueMemberId(const QString & agent_id,
     const AgentInfo * agentinfo = b_engine->agent(agent_id);
     const QueueInfo * queueinfo = b_engine->queue(queue_xid);
     if (agentinfo != NULL && queueinfo != NULL) {
-        QString agent_number = agentinfo->agentNumber();
-        QString queue_name = queueinfo->queueName();
-        foreach (const QString &queuemember_xid, b_engine->iterover("queuemembers").keys()) {
-            const QueueMemberInfo * queuememberinfo = b_engine->queuemember(queuemember_xid);
-            if (queuememberinfo->queueName() == queue_name
-                && queuememberinfo->agentNumber() == agent_number) {
-                return queuemember_xid;
-            }
-        }
+        return b_engine->index().queueMember(agentinfo->agentNumber(), queueinfo->queueName());
     }
     return "";
 }
 
 QStringList QueueMemberDAO::queueMembersFromAgentId(const QString & agent_id)
 {
-    QStringList ret;
-    QString agent_number = agentNumberFromAgentId(agent_id);
-    foreach (const QString & queue_member_id, b_engine->iterover("queuemembers").keys()) {
-        const QueueMemberInfo * queue_member = b_engine->queuemember(queue_member_id);
-        if (queue_member->agentNumber() == agent_number) {
-            ret << queue_member_id;
-        }
+    const AgentInfo * agentinfo = b_engine->agent(agent_id);
+    if (agentinfo == NULL) {
+        return QStringList();
     }
-    return ret;
+    return b_engine->index().queueMembersFromAgentNumber(agentinfo->agentNumber());
 }
 
 QueueAgentStatus QueueMemberDAO::getAgentStatus(const QueueMemberInfo *queue_member)
@@ -130,30 +102,10 @@ QueueAgentStatus QueueMemberDAO::getAgentStatus(const QueueMemberInfo *queue_mem
 
 int QueueMemberDAO::nbAgentsFromQueue(const QueueInfo * queue)
 {
-    int nb_of_agents = 0;
-
-    QHash<QString, XInfo *> queue_members = b_engine->iterover("queuemembers");
-    foreach (XInfo * info, queue_members.values()) {
-        QueueMemberInfo * queue_member = static_cast<QueueMemberInfo *>(info);
-        if ((queue_member->queueName() == queue->queueName()) && (queue_member->is_agent())) {
-            ++nb_of_agents;
-        }
-    }
-
-    return nb_of_agents;
+    return b_engine->index().agentCount(queue->queueName());
 }
 
 int QueueMemberDAO::nbNonAgentsFromQueue(const QueueInfo * queue)
 {
-    int nb_of_non_agents = 0;
-
-    QHash<QString, XInfo *> queue_members = b_engine->iterover("queuemembers");
-    foreach (XInfo * info, queue_members.values()) {
-        QueueMemberInfo * queue_member = static_cast<QueueMemberInfo *>(info);
-        if ((queue_member->queueName() == queue->queueName()) && (!queue_member->is_agent())) {
-            ++nb_of_non_agents;
-        }
-    }
-
-    return nb_of_non_agents;
+    return b_engine->index().nonAgentCount(queue->queueName());
 }
@@ -382,6 +382,16 @@ QVariantMap MessageFactory::importPersonalContactsCSV(const QByteArray &csv_cont
     return command;
 }
 
+QVariantMap MessageFactory::getlistUpdateConfig(const QString &listname, const QString &ipbxid, const QStringList &ids)
+{
+    return MessageFactory::getlist("updateconfig", listname, ipbxid, ids);
+}
+
+QVariantMap MessageFactory::getlistUpdateStatus(const QString &listname, const QString &ipbxid, const QStringList &ids)
+{
+    return MessageFactory::getlist("updatestatus", listname, ipbxid, ids);
+}
+
 QVariantMap MessageFactory::baseMessage(const QString &class_name)
 {
     QVariantMap message;
@@ -414,3 +424,14 @@ QVariantMap MessageFactory::setPresence(const QString &new_presence, const QStri
     message["userid"] = user_id;
     return message;
 }
+
+QVariantMap MessageFactory::getlist(const QString &function, const QString &listname,
+                                    const QString &ipbxid, const QStringList &ids)
+{
+    QVariantMap message = MessageFactory::baseMessage("getlist");
+    message["function"] = function;
+    message["listname"] = listname;
+    message["tipbxid"] = ipbxid;
+    message["tids"] = ids;
+    return message;
+}
@@ -34,6 +34,7 @@
 
 #include <QByteArray>
 #include <QString>
+#include <QStringList>
 #include <QVariant>
 #include <QVariantMap>
 
@@ -91,9 +92,13 @@ class BASELIB_EXPORT MessageFactory
         static QVariantMap importPersonalContactsCSV(const QByteArray &csv_contacts);
         static QVariantMap faxSend(const QString &filename, const QString &number, const QByteArray &content);
         static QVariantMap setPresence(const QString &presence, const QString &xivo_id, const QString &user_id);
+        static QVariantMap getlistUpdateConfig(const QString &listname, const QString &ipbxid, const QStringList &ids);
+        static QVariantMap getlistUpdateStatus(const QString &listname, const QString &ipbxid, const QStringList &ids);
     private:
         static QVariantMap baseMessage(const QString &class_name);
         static QVariantMap ipbxcommand(const QString &action_name);
+        static QVariantMap getlist(const QString &function, const QString &listname,
+                                   const QString &ipbxid, const QStringList &ids);
 };
 
 #endif /* __MESSAGE_FACTORY_H__ */
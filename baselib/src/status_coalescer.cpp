@@ -0,0 +1,103 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "status_coalescer.h"
+
+StatusCoalescer::StatusCoalescer(QObject *parent)
+    : QObject(parent)
+{
+    m_timer.setSingleShot(true);
+    m_timer.setInterval(0);
+    connect(&m_timer, SIGNAL(timeout()),
+            this, SLOT(flush()));
+}
+
+int StatusCoalescer::interval() const
+{
+    return m_timer.interval();
+}
+
+void StatusCoalescer::setInterval(int msec)
+{
+    m_timer.setInterval(qMax(0, msec));
+}
+
+bool StatusCoalescer::isPending() const
+{
+    return ! m_order.isEmpty();
+}
+
+void StatusCoalescer::markDirty(const QString &listname, const QString &xid, quint32 fields)
+{
+    if (! m_dirty.contains(listname)) {
+        m_order.append(listname);
+    }
+    m_dirty[listname].insert(xid);
+    m_fields[listname] |= fields;
+
+    if (! m_timer.isActive()) {
+        m_timer.start();
+    }
+}
+
+void StatusCoalescer::forget(const QString &listname, const QString &xid)
+{
+    QHash<QString, QSet<QString> >::iterator dirty = m_dirty.find(listname);
+    if (dirty != m_dirty.end()) {
+        dirty->remove(xid);
+    }
+}
+
+void StatusCoalescer::clear()
+{
+    m_timer.stop();
+    m_order.clear();
+    m_dirty.clear();
+    m_fields.clear();
+}
+
+void StatusCoalescer::flush()
+{
+    m_timer.stop();
+
+    // receivers may mark new xids, those go to the next batch
+    QStringList order;
+    QHash<QString, QSet<QString> > dirty;
+    QHash<QString, quint32> fields;
+    order.swap(m_order);
+    dirty.swap(m_dirty);
+    fields.swap(m_fields);
+
+    foreach (const QString &listname, order) {
+        const QSet<QString> &xids = dirty[listname];
+        if (! xids.isEmpty()) {
+            emit flushed(listname, xids, fields.value(listname));
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __STATUS_COALESCER_H__
+#define __STATUS_COALESCER_H__
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QString>
+#include <QStringList>
+#include <QTimer>
+
+#include "baselib_export.h"
+
+/*! \brief Accumulates the xids changed by a burst of CTI messages
+ *
+ * An xid marked dirty is kept once per list until the next flush, which
+ * happens when control returns to the event loop (interval of 0) or at
+ * most interval milliseconds after the first change of the batch.
+ *
+ * The change masks given with the xids are merged per list, so that the
+ * receivers know which fields changed in the batch.
+ */
+class BASELIB_EXPORT StatusCoalescer : public QObject
+{
+    Q_OBJECT
+
+    public:
+        StatusCoalescer(QObject *parent=NULL);
+
+        int interval() const;
+        void setInterval(int msec);
+        bool isPending() const;
+
+        void markDirty(const QString &listname, const QString &xid, quint32 fields=0xffffffff);
+        void forget(const QString &listname, const QString &xid);
+        void clear();
+
+    public slots:
+        void flush();
+
+    signals:
+        void flushed(const QString &listname, const QSet<QString> &xids, quint32 fields);
+
+    private:
+        QTimer m_timer;
+        QStringList m_order;                     //!< lists in the order they were first marked
+        QHash<QString, QSet<QString> > m_dirty;  //!< listname -> xids changed since last flush
+        QHash<QString, quint32> m_fields;        //!< listname -> fields changed since last flush
+};
+
+#endif
@@ -29,7 +29,6 @@
 
 #include "baseengine.h"
 #include "queueinfo.h"
-#include <dao/queuememberdao.h>
 #include <dao/queuedao.h>
 
 #include "agentinfo.h"
@@ -38,27 +37,39 @@
 AgentInfo::AgentInfo(const QString & ipbxid,
                      const QString & id)
     : XInfo(ipbxid, id),
-      m_availability_since(0.0)
+      m_availability_since(0.0),
+      m_queue_stats_valid(false)
 {
 }
 
-bool AgentInfo::updateConfig(const QVariantMap & prop)
+quint32 AgentInfo::updateConfig(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "context", & m_context);
-    haschanged |= setIfChangeString(prop, "number", & m_agentnumber);
-    haschanged |= setIfChangeString(prop, "firstname", & m_firstname);
-    haschanged |= setIfChangeString(prop, "lastname", & m_lastname);
+    static const XInfoField<AgentInfo, QString> fields[] = {
+        { "context", FIELD_CONTEXT, & AgentInfo::m_context },
+        { "number", FIELD_NUMBER, & AgentInfo::m_agentnumber },
+        { "firstname", FIELD_FIRSTNAME, & AgentInfo::m_firstname },
+        { "lastname", FIELD_LASTNAME, & AgentInfo::m_lastname }
+    };
+    static const XInfoFieldTable<AgentInfo> table(fields);
+
+    quint32 changed = table.update(this, prop);
 
     m_fullname = QString("%1 %2").arg(m_firstname).arg(m_lastname);
-    return haschanged;
+    m_queue_stats_valid = m_queue_stats_valid && ! changed;
+    return changed;
 }
 
-bool AgentInfo::updateStatus(const QVariantMap & prop)
+quint32 AgentInfo::updateStatus(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "availability", & m_availability);
-    haschanged |= setIfChangeDouble(prop, "availability_since", & m_availability_since);
+    static const XInfoField<AgentInfo, QString> fields[] = {
+        { "availability", FIELD_AVAILABILITY, & AgentInfo::m_availability }
+    };
+    static const XInfoField<AgentInfo, double> double_fields[] = {
+        { "availability_since", FIELD_AVAILABILITY_SINCE, & AgentInfo::m_availability_since }
+    };
+    static const XInfoFieldTable<AgentInfo> table(fields, double_fields);
+
+    quint32 changed = table.update(this, prop);
 
     if (prop.contains("queues")) {
         m_queue_ids.clear();
@@ -66,10 +77,11 @@ bool AgentInfo::updateStatus(const QVariantMap & prop)
             QString xqueueid = QString("%1/%2").arg(m_ipbxid).arg(queueid);
             m_queue_ids.append(xqueueid);
         }
-        haschanged = true;
+        changed |= FIELD_QUEUES;
+        m_queue_stats_valid = false;
     }
 
-    return haschanged;
+    return changed;
 }
 
 const QString & AgentInfo::context() const
@@ -137,68 +149,73 @@ bool AgentInfo::logged() const
     return this->availability() != LOGGED_OUT;
 }
 
-bool AgentInfo::paused() const
-{
-    QStringList queue_members = QueueMemberDAO::queueMembersFromAgentId(this->xid());
-    foreach (const QString & queue_member_id, queue_members) {
+/*! \brief compute the queue values of the agent if something changed since last call
+ *
+ * The XInfoIndex generations change with the queues and with the queue
+ * members of this agent, so views painting the same agent again get the
+ * cached values without walking the queue members.
+ */
+const AgentInfo::QueueStats & AgentInfo::queueStats() const
+{
+    const XInfoIndex &index = b_engine->index();
+    uint queues_generation = index.queuesGeneration();
+    uint members_generation = index.agentMembersGeneration(m_agentnumber);
+    if (m_queue_stats_valid
+        && m_queue_stats.queues_generation == queues_generation
+        && m_queue_stats.members_generation == members_generation) {
+        return m_queue_stats;
+    }
+
+    QueueStats stats;
+    stats.queues_generation = queues_generation;
+    stats.members_generation = members_generation;
+    stats.paused_count = 0;
+
+    QStringList queue_member_ids = index.queueMembersFromAgentNumber(m_agentnumber);
+    stats.joined_count = queue_member_ids.size();
+    foreach (const QString &queue_member_id, queue_member_ids) {
         const QueueMemberInfo * queue_member = b_engine->queuemember(queue_member_id);
         if (queue_member != NULL && queue_member->paused() == "1") {
-            return true;
+            ++stats.paused_count;
+            stats.paused_names << QueueDAO::queueDisplayNameFromQueueName(queue_member->queueName());
         }
     }
-    return false;
+
+    foreach (const QString &queue_id, m_queue_ids) {
+        const QueueInfo * queue = b_engine->queue(queue_id);
+        if (queue != NULL) {
+            stats.joined_names << queue->queueDisplayName();
+        }
+    }
+
+    m_queue_stats = stats;
+    m_queue_stats_valid = true;
+    return m_queue_stats;
 }
 
-int AgentInfo::joinedQueueCount() const
+bool AgentInfo::paused() const
 {
-    int joined_queues = 0;
+    return this->queueStats().paused_count > 0;
+}
 
-    QStringList queue_members = QueueMemberDAO::queueMembersFromAgentId(this->xid());
-    joined_queues = queue_members.size();
-    return joined_queues;
+int AgentInfo::joinedQueueCount() const
+{
+    return this->queueStats().joined_count;
 }
 
 QStringList AgentInfo::joinedQueueNames() const
 {
-    QStringList queue_ids = QueueMemberDAO::queueListFromAgentId(this->xid());
-    QStringList queue_names;
-    foreach (const QString &queue_id, queue_ids) {
-        const QueueInfo * queue = b_engine->queue(queue_id);
-        if (queue != NULL) {
-            queue_names << queue->queueDisplayName();
-        }
-    }
-    return queue_names;
+    return this->queueStats().joined_names;
 }
 
 QStringList AgentInfo::pausedQueueNames() const
 {
-    QStringList queue_names;
-    QStringList queue_members = QueueMemberDAO::queueMembersFromAgentId(this->xid());
-    foreach (const QString & queue_member_id, queue_members) {
-        const QueueMemberInfo * queue_member = b_engine->queuemember(queue_member_id);
-        if (queue_member != NULL && queue_member->paused() == "1") {
-            QString queue_name = queue_member->queueName();
-            QString display_name = QueueDAO::queueDisplayNameFromQueueName(queue_name);
-            queue_names << display_name;
-        }
-    }
-    return queue_names;
+    return this->queueStats().paused_names;
 }
 
-
 int AgentInfo::pausedQueueCount() const
 {
-    int paused_queues = 0;
-
-    QStringList queue_members = QueueMemberDAO::queueMembersFromAgentId(this->xid());
-    foreach (const QString & queue_member_id, queue_members) {
-        const QueueMemberInfo * queue_member = b_engine->queuemember(queue_member_id);
-        if (queue_member != NULL && queue_member->paused() == "1") {
-            ++paused_queues;
-        }
-    }
-    return paused_queues;
+    return this->queueStats().paused_count;
 }
 
 enum AgentPauseStatus AgentInfo::pausedStatus() const
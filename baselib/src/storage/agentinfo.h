@@ -55,9 +55,20 @@ class BASELIB_EXPORT AgentInfo : public XInfo
             ON_CALL_NONACD_OUTGOING_EXTERNAL
         };
 
+        //! bits of the change masks returned by updateConfig and updateStatus
+        enum Field {
+            FIELD_CONTEXT = 1 << 0,
+            FIELD_NUMBER = 1 << 1,
+            FIELD_FIRSTNAME = 1 << 2,
+            FIELD_LASTNAME = 1 << 3,
+            FIELD_AVAILABILITY = 1 << 4,
+            FIELD_AVAILABILITY_SINCE = 1 << 5,
+            FIELD_QUEUES = 1 << 6
+        };
+
         AgentInfo(const QString &, const QString &);
-        bool updateConfig(const QVariantMap &);
-        bool updateStatus(const QVariantMap &);
+        quint32 updateConfig(const QVariantMap &);
+        quint32 updateStatus(const QVariantMap &);
 
         const QString & context() const;
         const QString & agentNumber() const;
@@ -80,6 +91,18 @@ class BASELIB_EXPORT AgentInfo : public XInfo
         QStringList pausedQueueNames() const;
         QStringList joinedQueueNames() const;
     private:
+        //! values derived from the queues and queue members of the agent
+        struct QueueStats {
+            uint queues_generation;
+            uint members_generation;
+            int joined_count;
+            int paused_count;
+            QStringList joined_names;
+            QStringList paused_names;
+        };
+
+        const QueueStats & queueStats() const;
+
         QString m_context;
         QString m_agentnumber;
         QString m_firstname;
@@ -92,6 +115,9 @@ class BASELIB_EXPORT AgentInfo : public XInfo
         QVariantMap m_properties;
 
         QStringList m_queue_ids;
+
+        mutable QueueStats m_queue_stats;   //!< valid for the generations it holds
+        mutable bool m_queue_stats_valid;   //!< false until computed and after a change of the agent
 };
 
 #endif
@@ -34,7 +34,10 @@
 #include "init_watcher.h"
 
 InitWatcher::InitWatcher()
-    : m_watching_started(false)
+    : m_total_count(0),
+      m_pending_count(0),
+      m_last_percent(-1),
+      m_watching_started(false)
 {
 }
 
@@ -43,9 +46,16 @@ void InitWatcher::watchList(QString list_name, QStringList ids)
     if (ids.isEmpty()) {
         return;
     }
-    m_stack.insert(list_name, ids);
+
+    const QSet<QString> &pending = ids.toSet();
+    m_total_count += pending.size() - m_totals.value(list_name);
+    m_pending_count += pending.size() - m_pending.value(list_name).size();
+    m_pending.insert(list_name, pending);
+    m_totals.insert(list_name, pending.size());
+
     if (m_watching_started == false) {
         m_watching_started = true;
+        m_elapsed.start();
         qDebug() << "Initializing...";
         emit watching();
     }
@@ -53,14 +63,51 @@ void InitWatcher::watchList(QString list_name, QStringList ids)
 
 void InitWatcher::sawItem(const QString & list_name, const QString & item_id)
 {
-    m_stack[list_name].removeOne(item_id);
-    if (m_stack[list_name].isEmpty()) {
-        m_stack.remove(list_name);
+    QHash<QString, QSet<QString> >::iterator list = m_pending.find(list_name);
+    if (list == m_pending.end() || ! list->remove(item_id)) {
+        return;
+    }
+
+    m_pending_count--;
+    if (list->isEmpty()) {
+        m_pending.erase(list);
+        qDebug() << "Initialized" << list_name << m_totals.value(list_name)
+                 << "items in" << m_elapsed.elapsed() << "ms";
     }
 
-    if (m_stack.isEmpty() && m_watching_started) {
+    int percent = 100 * this->seenCount() / m_total_count;
+    if (percent != m_last_percent) {
+        m_last_percent = percent;
+        emit progress(this->seenCount(), m_total_count);
+    }
+
+    if (m_pending.isEmpty() && m_watching_started) {
         m_watching_started = false;
+        m_totals.clear();
+        m_total_count = 0;
+        m_pending_count = 0;
+        m_last_percent = -1;
         qDebug() << "Initialization complete";
         emit sawAll();
     }
 }
+
+int InitWatcher::seenCount(const QString & list_name) const
+{
+    return m_totals.value(list_name) - m_pending.value(list_name).size();
+}
+
+int InitWatcher::totalCount(const QString & list_name) const
+{
+    return m_totals.value(list_name);
+}
+
+int InitWatcher::seenCount() const
+{
+    return m_total_count - m_pending_count;
+}
+
+int InitWatcher::totalCount() const
+{
+    return m_total_count;
+}
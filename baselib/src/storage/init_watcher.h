@@ -31,11 +31,18 @@
 #define __INIT_WATCHER__
 
 #include <QObject>
+#include <QElapsedTimer>
 #include <QHash>
+#include <QSet>
 
 #include <QString>
 #include <QStringList>
 
+/*! \brief tells when every item of the initial lists was received
+ *
+ * Pending ids are kept in a set per list, so seeing an item is O(1)
+ * whatever the size of the list.
+ */
 class InitWatcher: public QObject
 {
     Q_OBJECT
@@ -45,14 +52,25 @@ class InitWatcher: public QObject
         void watchList(QString list_name, QStringList ids);
         void sawItem(const QString & list_name, const QString & item_id);
 
+        int seenCount(const QString & list_name) const;
+        int totalCount(const QString & list_name) const;
+        int seenCount() const;
+        int totalCount() const;
+
     signals:
         void sawAll();
         void watching();
+        void progress(int seen, int total);  //!< emitted each time another percent of the items is seen
 
     public slots:
 
     private:
-        QHash<QString, QStringList> m_stack;
+        QHash<QString, QSet<QString> > m_pending;   //!< ids not seen yet, by list
+        QHash<QString, int> m_totals;               //!< number of ids to see, by list
+        int m_total_count;
+        int m_pending_count;
+        int m_last_percent;                         //!< progress last emitted
+        QElapsedTimer m_elapsed;                    //!< since watching started
         bool m_watching_started;
 
         friend class TestInitWatcher;
@@ -36,24 +36,31 @@ PhoneInfo::PhoneInfo(const QString & ipbxid,
 }
 
 
-bool PhoneInfo::updateConfig(const QVariantMap & prop)
+quint32 PhoneInfo::updateConfig(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "number", & m_number);
-    haschanged |= setIfChangeString(prop, "identity", & m_identity);
+    static const XInfoField<PhoneInfo, QString> fields[] = {
+        { "number", FIELD_NUMBER, & PhoneInfo::m_number },
+        { "identity", FIELD_IDENTITY, & PhoneInfo::m_identity },
+        { "iduserfeatures", FIELD_USER_FEATURES, & PhoneInfo::m_iduserfeatures }
+    };
+    static const XInfoFieldTable<PhoneInfo> table(fields);
+
+    quint32 changed = table.update(this, prop);
     //! \todo: fix somewhere else
     if (m_identity.contains("\\/")) {
         m_identity.replace("\\/", "/");
     }
-    haschanged |= setIfChangeString(prop, "iduserfeatures", & m_iduserfeatures);
-    return haschanged;
+    return changed;
 }
 
-bool PhoneInfo::updateStatus(const QVariantMap & prop)
+quint32 PhoneInfo::updateStatus(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "hintstatus", & m_hintstatus);
-    return haschanged;
+    static const XInfoField<PhoneInfo, QString> fields[] = {
+        { "hintstatus", FIELD_HINTSTATUS, & PhoneInfo::m_hintstatus }
+    };
+    static const XInfoFieldTable<PhoneInfo> table(fields);
+
+    return table.update(this, prop);
 }
 
 QString PhoneInfo::xid_user_features() const
@@ -41,10 +41,18 @@
 class BASELIB_EXPORT PhoneInfo : public XInfo
 {
     public:
+        //! bits of the change masks returned by updateConfig and updateStatus
+        enum Field {
+            FIELD_NUMBER = 1 << 0,
+            FIELD_IDENTITY = 1 << 1,
+            FIELD_USER_FEATURES = 1 << 2,
+            FIELD_HINTSTATUS = 1 << 3
+        };
+
         PhoneInfo(const QString &, const QString &);
         virtual ~PhoneInfo() {}
-        bool updateConfig(const QVariantMap &);
-        bool updateStatus(const QVariantMap &);
+        quint32 updateConfig(const QVariantMap &);
+        quint32 updateStatus(const QVariantMap &);
         virtual const QString &number() const { return m_number; };
         const QString & identity() const { return m_identity; };
         const QString & iduserfeatures() const { return m_iduserfeatures; };
@@ -36,19 +36,22 @@ QueueInfo::QueueInfo(const QString & ipbxid,
 {
 }
 
-bool QueueInfo::updateConfig(const QVariantMap & prop)
+quint32 QueueInfo::updateConfig(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "context", & m_context);
-    haschanged |= setIfChangeString(prop, "name", & m_name);
-    haschanged |= setIfChangeString(prop, "displayname", & m_displayname);
-    haschanged |= setIfChangeString(prop, "number", & m_number);
-    return haschanged;
+    static const XInfoField<QueueInfo, QString> fields[] = {
+        { "context", FIELD_CONTEXT, & QueueInfo::m_context },
+        { "name", FIELD_NAME, & QueueInfo::m_name },
+        { "displayname", FIELD_DISPLAYNAME, & QueueInfo::m_displayname },
+        { "number", FIELD_NUMBER, & QueueInfo::m_number }
+    };
+    static const XInfoFieldTable<QueueInfo> table(fields);
+
+    return table.update(this, prop);
 }
 
-bool QueueInfo::updateStatus(const QVariantMap & /*prop*/)
+quint32 QueueInfo::updateStatus(const QVariantMap & /*prop*/)
 {
-    return false;
+    return 0;
 }
 
 const QString & QueueInfo::context() const
@@ -41,9 +41,17 @@
 class BASELIB_EXPORT QueueInfo : public XInfo
 {
     public:
+        //! bits of the change mask returned by updateConfig
+        enum Field {
+            FIELD_CONTEXT = 1 << 0,
+            FIELD_NAME = 1 << 1,
+            FIELD_DISPLAYNAME = 1 << 2,
+            FIELD_NUMBER = 1 << 3
+        };
+
         QueueInfo(const QString &, const QString &);
-        bool updateConfig(const QVariantMap &);
-        bool updateStatus(const QVariantMap &);
+        quint32 updateConfig(const QVariantMap &);
+        quint32 updateStatus(const QVariantMap &);
         const QString & context() const;
         const QString & queueNumber() const;
         const QString & queueName() const;
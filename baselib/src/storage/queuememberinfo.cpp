@@ -37,32 +37,32 @@ QueueMemberInfo::QueueMemberInfo(const QString & ipbxid,
 {
 }
 
-bool QueueMemberInfo::updateConfig(const QVariantMap &prop)
+quint32 QueueMemberInfo::updateConfig(const QVariantMap &prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "queue_name", & m_queue_name);
-    haschanged |= setIfChangeString(prop, "interface", & m_interface);
-    haschanged |= setIfChangeString(prop, "status", & m_status);
-    haschanged |= setIfChangeString(prop, "paused", & m_paused);
-    haschanged |= setIfChangeString(prop, "membership", & m_membership);
-    haschanged |= setIfChangeString(prop, "penalty", & m_penalty);
-    haschanged |= setIfChangeString(prop, "callstaken", & m_callstaken);
-    haschanged |= setIfChangeString(prop, "lastcall", & m_lastcall);
-    return haschanged;
+    return this->updateFields(prop);
 }
 
-bool QueueMemberInfo::updateStatus(const QVariantMap & prop)
+quint32 QueueMemberInfo::updateStatus(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "queue_name", & m_queue_name);
-    haschanged |= setIfChangeString(prop, "interface", & m_interface);
-    haschanged |= setIfChangeString(prop, "status", & m_status);
-    haschanged |= setIfChangeString(prop, "paused", & m_paused);
-    haschanged |= setIfChangeString(prop, "membership", & m_membership);
-    haschanged |= setIfChangeString(prop, "penalty", & m_penalty);
-    haschanged |= setIfChangeString(prop, "callstaken", & m_callstaken);
-    haschanged |= setIfChangeString(prop, "lastcall", & m_lastcall);
-    return haschanged;
+    return this->updateFields(prop);
+}
+
+//! the config and the status of a queue member carry the same fields
+quint32 QueueMemberInfo::updateFields(const QVariantMap & prop)
+{
+    static const XInfoField<QueueMemberInfo, QString> fields[] = {
+        { "queue_name", FIELD_QUEUE_NAME, & QueueMemberInfo::m_queue_name },
+        { "interface", FIELD_INTERFACE, & QueueMemberInfo::m_interface },
+        { "status", FIELD_STATUS, & QueueMemberInfo::m_status },
+        { "paused", FIELD_PAUSED, & QueueMemberInfo::m_paused },
+        { "membership", FIELD_MEMBERSHIP, & QueueMemberInfo::m_membership },
+        { "penalty", FIELD_PENALTY, & QueueMemberInfo::m_penalty },
+        { "callstaken", FIELD_CALLSTAKEN, & QueueMemberInfo::m_callstaken },
+        { "lastcall", FIELD_LASTCALL, & QueueMemberInfo::m_lastcall }
+    };
+    static const XInfoFieldTable<QueueMemberInfo> table(fields);
+
+    return table.update(this, prop);
 }
 
 bool QueueMemberInfo::is_agent() const
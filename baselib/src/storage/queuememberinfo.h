@@ -37,9 +37,21 @@
 class BASELIB_EXPORT QueueMemberInfo : public XInfo
 {
     public:
+        //! bits of the change masks returned by updateConfig and updateStatus
+        enum Field {
+            FIELD_QUEUE_NAME = 1 << 0,
+            FIELD_INTERFACE = 1 << 1,
+            FIELD_STATUS = 1 << 2,
+            FIELD_PAUSED = 1 << 3,
+            FIELD_MEMBERSHIP = 1 << 4,
+            FIELD_PENALTY = 1 << 5,
+            FIELD_CALLSTAKEN = 1 << 6,
+            FIELD_LASTCALL = 1 << 7
+        };
+
         QueueMemberInfo(const QString &, const QString &); //! constructor
-        bool updateConfig(const QVariantMap &);  //! update config members
-        bool updateStatus(const QVariantMap &);  //! update status members
+        quint32 updateConfig(const QVariantMap &);  //! update config members
+        quint32 updateStatus(const QVariantMap &);  //! update status members
 
         const QString & status() const { return m_status; };
         const QString & paused() const { return m_paused; };
@@ -53,6 +65,8 @@ class BASELIB_EXPORT QueueMemberInfo : public XInfo
         QString lastcall() const { return m_lastcall; };
         bool is_agent() const;
     private:
+        quint32 updateFields(const QVariantMap &);
+
         QString m_status;
         QString m_paused;
         QString m_membership;
@@ -30,6 +30,9 @@
 #include <QtTest/QtTest>
 
 #include "test_init_watcher.h"
+#include "test_xinfo_fields.h"
+#include "test_xinfo_index.h"
+#include "test_xinfo_storage.h"
 
 // To run the tests use
 // export LD_LIBRARY_PATH=../../bin
@@ -38,7 +41,13 @@
 int main (int argc, char *argv[])
 {
     TestInitWatcher test_init_watcher;
+    TestXInfoFields test_xinfo_fields;
+    TestXInfoIndex test_xinfo_index;
+    TestXInfoStorage test_xinfo_storage;
 
     QTest::qExec(&test_init_watcher, argc, argv);
+    QTest::qExec(&test_xinfo_fields, argc, argv);
+    QTest::qExec(&test_xinfo_index, argc, argv);
+    QTest::qExec(&test_xinfo_storage, argc, argv);
     return 0;
 }
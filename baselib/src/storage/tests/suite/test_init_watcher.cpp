@@ -40,15 +40,15 @@ void TestInitWatcher::testWatchList()
     QStringList ids_1 = QStringList() << "1" << "2" << "3";
     QStringList ids_2 = QStringList() << "4" << "5" << "6";
 
-    QHash<QString, QStringList> expected_stack;
-    expected_stack.insert(list_name_1, ids_1);
-    expected_stack.insert(list_name_2, ids_2);
+    QHash<QString, QSet<QString> > expected_pending;
+    expected_pending.insert(list_name_1, ids_1.toSet());
+    expected_pending.insert(list_name_2, ids_2.toSet());
     InitWatcher init_watcher;
 
     init_watcher.watchList(list_name_1, ids_1);
     init_watcher.watchList(list_name_2, ids_2);
 
-    QCOMPARE(expected_stack, init_watcher.m_stack);
+    QCOMPARE(expected_pending, init_watcher.m_pending);
 }
 
 void TestInitWatcher::testSawItem()
@@ -64,13 +64,13 @@ void TestInitWatcher::testSawItem()
     init_watcher.sawItem(list_name_2, ids_2[0]);
     init_watcher.sawItem(list_name_2, ids_2[1]);
 
-    QStringList expected_ids = QStringList() << "6";
-    QCOMPARE(expected_ids, init_watcher.m_stack[list_name_2]);
+    QSet<QString> expected_ids = QSet<QString>() << "6";
+    QCOMPARE(expected_ids, init_watcher.m_pending[list_name_2]);
 
     init_watcher.sawItem(list_name_2, ids_2[2]);
 
     QStringList expected_lists = QStringList() << list_name_1;
-    QStringList lists = init_watcher.m_stack.keys();
+    QStringList lists = init_watcher.m_pending.keys();
     QCOMPARE(expected_lists, lists);
 }
 
@@ -109,7 +109,7 @@ void TestInitWatcher::testWatchListEmpty()
     init_watcher.watchList(list_name_1, ids_1);
     init_watcher.watchList(list_name_2, ids_2);
 
-    const QStringList & lists = init_watcher.m_stack.keys();
+    const QStringList & lists = init_watcher.m_pending.keys();
     QVERIFY(lists.contains(list_name_2) == false);
 }
 
@@ -135,3 +135,27 @@ void TestInitWatcher::testWatching()
 
     QCOMPARE(spy.count(), 1);
 }
+
+void TestInitWatcher::testProgress()
+{
+    QString list_name_1("superlist"), list_name_2("megalist");
+    QStringList ids_1 = QStringList() << "1" << "2" << "3";
+    QStringList ids_2 = QStringList() << "4";
+
+    InitWatcher init_watcher;
+    init_watcher.watchList(list_name_1, ids_1);
+    init_watcher.watchList(list_name_2, ids_2);
+    QSignalSpy spy(&init_watcher, SIGNAL(progress(int, int)));
+
+    init_watcher.sawItem(list_name_1, ids_1[0]);
+    init_watcher.sawItem(list_name_1, ids_1[0]);
+    init_watcher.sawItem(list_name_1, ids_1[1]);
+
+    QCOMPARE(init_watcher.seenCount(list_name_1), 2);
+    QCOMPARE(init_watcher.totalCount(list_name_1), 3);
+    QCOMPARE(init_watcher.seenCount(), 2);
+    QCOMPARE(init_watcher.totalCount(), 4);
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(spy.last().at(0).toInt(), 2);
+    QCOMPARE(spy.last().at(1).toInt(), 4);
+}
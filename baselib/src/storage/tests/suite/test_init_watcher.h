@@ -44,6 +44,7 @@ class TestInitWatcher: public QObject
         void testSawAll();
         void testWatchListEmpty();
         void testWatching();
+        void testProgress();
 };
 
 #endif
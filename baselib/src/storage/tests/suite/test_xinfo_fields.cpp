@@ -0,0 +1,112 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+
+#include <xinfo.h>
+#include <queueinfo.h>
+#include <voicemailinfo.h>
+
+#include "test_xinfo_fields.h"
+
+struct Line
+{
+    QString name;
+    bool enabled;
+
+    quint32 update(const QVariantMap &prop)
+    {
+        static const XInfoField<Line, QString> fields[] = {
+            { "name", 1 << 0, & Line::name }
+        };
+        static const XInfoField<Line, bool> bool_fields[] = {
+            { "enabled", 1 << 1, & Line::enabled }
+        };
+        static const XInfoFieldTable<Line> table(fields, bool_fields);
+
+        return table.update(this, prop);
+    }
+};
+
+void TestXInfoFields::testChangeMask()
+{
+    QueueInfo queue("xivo", "1");
+    QVariantMap config;
+    config["name"] = "sales";
+    config["number"] = "3000";
+
+    QCOMPARE(queue.updateConfig(config), quint32(QueueInfo::FIELD_NAME | QueueInfo::FIELD_NUMBER));
+    QCOMPARE(queue.queueName(), QString("sales"));
+    QCOMPARE(queue.queueNumber(), QString("3000"));
+
+    config["number"] = "3001";
+    QCOMPARE(queue.updateConfig(config), quint32(QueueInfo::FIELD_NUMBER));
+    QCOMPARE(queue.updateConfig(config), quint32(0));
+}
+
+void TestXInfoFields::testUnknownKeys()
+{
+    QueueInfo queue("xivo", "1");
+    QVariantMap config;
+    config["unknown"] = "value";
+    config["displayname"] = "Sales";
+
+    QCOMPARE(queue.updateConfig(config), quint32(QueueInfo::FIELD_DISPLAYNAME));
+    QCOMPARE(queue.queueDisplayName(), QString("Sales"));
+    QVERIFY(queue.queueName().isEmpty());
+}
+
+void TestXInfoFields::testTypes()
+{
+    VoiceMailInfo voicemail("xivo", "1");
+    QVariantMap status;
+    status["new"] = "3";
+
+    QCOMPARE(voicemail.updateStatus(status), quint32(VoiceMailInfo::FIELD_NEW_MESSAGES));
+    QCOMPARE(voicemail.newMessages(), 3);
+
+    status["new"] = 3;
+    QCOMPARE(voicemail.updateStatus(status), quint32(0));
+}
+
+void TestXInfoFields::testSeveralTables()
+{
+    Line line;
+    line.enabled = false;
+    QVariantMap config;
+    config["name"] = "line 1";
+    config["enabled"] = true;
+
+    QCOMPARE(line.update(config), quint32(1 << 0 | 1 << 1));
+    QCOMPARE(line.name, QString("line 1"));
+    QCOMPARE(line.enabled, true);
+
+    config["enabled"] = false;
+    QCOMPARE(line.update(config), quint32(1 << 1));
+}
@@ -1,4 +1,7 @@
-/* Copyright (C) 2007-2014 Avencall
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
  *
  * XiVO Client is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -24,26 +27,22 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef _AGENT_STATUS_WIDGET_H_
-#define _AGENT_STATUS_WIDGET_H_
+#ifndef __TEST_XINFO_FIELDS__
+#define __TEST_XINFO_FIELDS__
 
-#include <QWidget>
+#include <QObject>
 
-class AgentStatusWidget: public QWidget
+class TestXInfoFields: public QObject
 {
     Q_OBJECT
 
-public:
-    AgentStatusWidget(QWidget * parent = NULL);
-    ~AgentStatusWidget();
-
-    void setAvailabilityStyle(const QString &object_name);
-    void setAvailabilityText(const QString &availability_text);
-    void setAgentName(const QString &agent_name);
-    void setStatusSince(const QString &status_since);
+    public:
 
-protected:
-    void paintEvent(QPaintEvent* paint_event);
+    private slots:
+        void testChangeMask();
+        void testUnknownKeys();
+        void testTypes();
+        void testSeveralTables();
 };
 
-#endif /* _AGENT_STATUS_WIDGET_H_ */
+#endif
@@ -0,0 +1,185 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+
+#include <xinfo_index.h>
+
+#include "test_xinfo_index.h"
+
+void TestXInfoIndex::testAgentFromNumber()
+{
+    XInfoIndex index;
+
+    index.updateAgent("xivo/1", "1001");
+    index.updateAgent("xivo/2", "1002");
+
+    QCOMPARE(index.agentFromNumber("1001"), QString("xivo/1"));
+    QCOMPARE(index.agentFromNumber("1002"), QString("xivo/2"));
+
+    index.removeAgent("xivo/1");
+
+    QVERIFY(index.agentFromNumber("1001").isEmpty());
+}
+
+void TestXInfoIndex::testAgentNumberChange()
+{
+    XInfoIndex index;
+
+    index.updateAgent("xivo/1", "1001");
+    index.updateAgent("xivo/1", "2001");
+
+    QVERIFY(index.agentFromNumber("1001").isEmpty());
+    QCOMPARE(index.agentFromNumber("2001"), QString("xivo/1"));
+}
+
+void TestXInfoIndex::testPhoneFromIdentity()
+{
+    XInfoIndex index;
+
+    index.updatePhone("xivo/1", "SIP/abcdef");
+    index.updatePhone("xivo/2", "SIP/ghijkl");
+    index.updatePhone("xivo/1", "SIP/mnopqr");
+
+    QVERIFY(index.phoneFromIdentity("SIP/abcdef").isEmpty());
+    QCOMPARE(index.phoneFromIdentity("SIP/mnopqr"), QString("xivo/1"));
+    QCOMPARE(index.phoneFromIdentity("SIP/ghijkl"), QString("xivo/2"));
+
+    index.removePhone("xivo/2");
+
+    QVERIFY(index.phoneFromIdentity("SIP/ghijkl").isEmpty());
+}
+
+void TestXInfoIndex::testQueueFromName()
+{
+    XInfoIndex index;
+
+    index.updateQueue("xivo/1", "sales");
+    index.updateQueue("xivo/1", "support");
+
+    QVERIFY(index.queueFromName("sales").isEmpty());
+    QCOMPARE(index.queueFromName("support"), QString("xivo/1"));
+
+    index.removeQueue("xivo/1");
+
+    QVERIFY(index.queueFromName("support").isEmpty());
+}
+
+void TestXInfoIndex::testQueueMember()
+{
+    XInfoIndex index;
+
+    index.updateQueueMember("xivo/1", "sales", "1001", true);
+    index.updateQueueMember("xivo/2", "support", "1001", true);
+    index.updateQueueMember("xivo/3", "sales", "1002", true);
+
+    QCOMPARE(index.queueMember("1001", "support"), QString("xivo/2"));
+
+    QStringList members = index.queueMembersFromAgentNumber("1001");
+    members.sort();
+    QCOMPARE(members, QStringList() << "xivo/1" << "xivo/2");
+
+    index.removeQueueMember("xivo/2");
+
+    QVERIFY(index.queueMember("1001", "support").isEmpty());
+    QCOMPARE(index.queueMembersFromAgentNumber("1001"), QStringList() << "xivo/1");
+}
+
+void TestXInfoIndex::testQueueMemberMoved()
+{
+    XInfoIndex index;
+
+    index.updateQueueMember("xivo/1", "sales", "1001", true);
+    index.updateQueueMember("xivo/1", "support", "1001", true);
+
+    QVERIFY(index.queueMember("1001", "sales").isEmpty());
+    QCOMPARE(index.queueMember("1001", "support"), QString("xivo/1"));
+    QCOMPARE(index.agentCount("sales"), 0);
+    QCOMPARE(index.agentCount("support"), 1);
+}
+
+void TestXInfoIndex::testMemberCounts()
+{
+    XInfoIndex index;
+
+    index.updateQueueMember("xivo/1", "sales", "1001", true);
+    index.updateQueueMember("xivo/2", "sales", "1002", true);
+    index.updateQueueMember("xivo/3", "sales", "abcdef", false);
+
+    QCOMPARE(index.agentCount("sales"), 2);
+    QCOMPARE(index.nonAgentCount("sales"), 1);
+    QVERIFY(index.queueMembersFromAgentNumber("abcdef").isEmpty());
+
+    index.removeQueueMember("xivo/3");
+    index.clear();
+
+    QCOMPARE(index.agentCount("sales"), 0);
+    QCOMPARE(index.nonAgentCount("sales"), 0);
+}
+
+void TestXInfoIndex::testGenerations()
+{
+    XInfoIndex index;
+    index.updateQueueMember("xivo/1", "sales", "1001", true);
+    index.updateQueueMember("xivo/2", "sales", "1002", true);
+    uint queues_generation = index.queuesGeneration();
+    uint agent_1001_generation = index.agentMembersGeneration("1001");
+    uint agent_1002_generation = index.agentMembersGeneration("1002");
+
+    index.updateQueueMember("xivo/1", "sales", "1001", true);
+
+    QCOMPARE(index.agentMembersGeneration("1001"), agent_1001_generation);
+
+    index.updateQueueMember("xivo/1", "support", "1001", true);
+
+    QVERIFY(index.agentMembersGeneration("1001") != agent_1001_generation);
+    QCOMPARE(index.agentMembersGeneration("1002"), agent_1002_generation);
+    QCOMPARE(index.queuesGeneration(), queues_generation);
+    agent_1001_generation = index.agentMembersGeneration("1001");
+
+    index.touchQueueMember("xivo/1");
+
+    QVERIFY(index.agentMembersGeneration("1001") != agent_1001_generation);
+    QCOMPARE(index.agentMembersGeneration("1002"), agent_1002_generation);
+
+    index.updateQueue("xivo/1", "sales");
+    queues_generation = index.queuesGeneration();
+    index.updateQueue("xivo/1", "sales");
+
+    QCOMPARE(index.queuesGeneration(), queues_generation);
+
+    index.updateQueue("xivo/1", "sales2");
+
+    QVERIFY(index.queuesGeneration() != queues_generation);
+    queues_generation = index.queuesGeneration();
+
+    index.clear();
+
+    QVERIFY(index.queuesGeneration() != queues_generation);
+}
@@ -0,0 +1,105 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+#include <QDebug>
+
+#if defined(__GLIBC__)
+#include <malloc.h>
+#endif
+
+#include <queueinfo.h>
+
+#include "test_xinfo_storage.h"
+
+static const int NbEntities = 50000;
+
+void TestXInfoStorage::testMakeXid()
+{
+    QueueInfo queue("xivo", "42");
+
+    QCOMPARE(XInfo::makeXid("xivo", "42"), QString("xivo/42"));
+    QCOMPARE(queue.xid(), QString("xivo/42"));
+}
+
+void TestXInfoStorage::testSharedKey()
+{
+    QHash<QString, XInfo *> list;
+    QueueInfo queue("xivo", "1");
+
+    list.insert(queue.xid(), &queue);
+
+    QCOMPARE(list.constBegin().key().constData(), queue.xid().constData());
+}
+
+static size_t allocatedBytes()
+{
+#if defined(__GLIBC__)
+    return mallinfo().uordblks;
+#else
+    return 0;
+#endif
+}
+
+void TestXInfoStorage::benchmarkBytesPerEntity()
+{
+    if (allocatedBytes() == 0) {
+        QSKIP("heap statistics are not available on this platform");
+    }
+
+    size_t formatted;
+    size_t before = allocatedBytes();
+    {
+        // each list key used to be formatted apart from the xid of its object
+        QHash<QString, XInfo *> list;
+        for (int i = 0; i < NbEntities; ++i) {
+            QString id = QString::number(i);
+            QString xid = QString("%1/%2").arg("xivo").arg(id);
+            list[xid] = new QueueInfo("xivo", id);
+        }
+        formatted = allocatedBytes() - before;
+        qDebug() << "formatted keys:" << formatted / NbEntities << "bytes per entity";
+        qDeleteAll(list);
+    }
+
+    size_t shared;
+    before = allocatedBytes();
+    {
+        QHash<QString, XInfo *> list;
+        for (int i = 0; i < NbEntities; ++i) {
+            XInfo *queue = new QueueInfo("xivo", QString::number(i));
+            list.insert(queue->xid(), queue);
+        }
+        shared = allocatedBytes() - before;
+        qDebug() << "shared keys:" << shared / NbEntities << "bytes per entity";
+        qDeleteAll(list);
+    }
+
+    QVERIFY(shared < formatted);
+}
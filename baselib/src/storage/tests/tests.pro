@@ -22,3 +22,15 @@ SOURCES += $${ROOT_DIR}/src/storage/tests/suite/*.cpp
 
 HEADERS += $${ROOT_DIR}/src/storage/init_watcher.h
 SOURCES += $${ROOT_DIR}/src/storage/init_watcher.cpp
+
+HEADERS += $${ROOT_DIR}/src/storage/xinfo_index.h
+SOURCES += $${ROOT_DIR}/src/storage/xinfo_index.cpp
+
+HEADERS += $${ROOT_DIR}/src/storage/xinfo.h
+SOURCES += $${ROOT_DIR}/src/storage/xinfo.cpp
+
+HEADERS += $${ROOT_DIR}/src/storage/queueinfo.h
+SOURCES += $${ROOT_DIR}/src/storage/queueinfo.cpp
+
+HEADERS += $${ROOT_DIR}/src/storage/voicemailinfo.h
+SOURCES += $${ROOT_DIR}/src/storage/voicemailinfo.cpp
@@ -41,29 +41,41 @@ UserInfo::UserInfo(const QString & ipbxid,
     m_enablebusy(false),
     m_availstate(__presence_off__)
 {
+    m_xvoicemailid = QString("%1/%2").arg(m_ipbxid).arg(m_voicemailid);
+    m_xagentid = QString("%1/%2").arg(m_ipbxid).arg(m_agentid);
 }
 
-bool UserInfo::updateConfig(const QVariantMap & prop)
+quint32 UserInfo::updateConfig(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "fullname", & m_fullname);
-    haschanged |= setIfChangeString(prop, "voicemailid", & m_voicemailid);
-    m_xvoicemailid = QString("%1/%2").arg(m_ipbxid).arg(m_voicemailid);
-    haschanged |= setIfChangeString(prop, "agentid", & m_agentid);
-    m_xagentid = QString("%1/%2").arg(m_ipbxid).arg(m_agentid);
-    haschanged |= setIfChangeString(prop, "mobilephonenumber", & m_mobilenumber);
-    haschanged |= setIfChangeBool(prop, "enablevoicemail", & m_enablevoicemail);
-    haschanged |= setIfChangeBool(prop, "incallfilter", & m_incallfilter);
-    haschanged |= setIfChangeBool(prop, "enablednd", & m_enablednd);
-    haschanged |= setIfChangeBool(prop, "enableunc", & m_enableunc);
-    haschanged |= setIfChangeString(prop, "destunc", & m_destunc);
-    haschanged |= setIfChangeBool(prop, "enablerna", & m_enablerna);
-    haschanged |= setIfChangeString(prop, "destrna", & m_destrna);
-    haschanged |= setIfChangeBool(prop, "enablebusy", & m_enablebusy);
-    haschanged |= setIfChangeString(prop, "destbusy", & m_destbusy);
-    haschanged |= setIfChangeString(prop, "firstname", & m_firstname);
-    haschanged |= setIfChangeString(prop, "lastname", & m_lastname);
-    haschanged |= setIfChangeString(prop, "xivo_uuid", & m_xivo_uuid);
+    static const XInfoField<UserInfo, QString> fields[] = {
+        { "fullname", FIELD_FULLNAME, & UserInfo::m_fullname },
+        { "firstname", FIELD_FIRSTNAME, & UserInfo::m_firstname },
+        { "lastname", FIELD_LASTNAME, & UserInfo::m_lastname },
+        { "voicemailid", FIELD_VOICEMAIL_ID, & UserInfo::m_voicemailid },
+        { "agentid", FIELD_AGENT_ID, & UserInfo::m_agentid },
+        { "mobilephonenumber", FIELD_MOBILE_NUMBER, & UserInfo::m_mobilenumber },
+        { "destunc", FIELD_DEST_UNC, & UserInfo::m_destunc },
+        { "destrna", FIELD_DEST_RNA, & UserInfo::m_destrna },
+        { "destbusy", FIELD_DEST_BUSY, & UserInfo::m_destbusy },
+        { "xivo_uuid", FIELD_XIVO_UUID, & UserInfo::m_xivo_uuid }
+    };
+    static const XInfoField<UserInfo, bool> bool_fields[] = {
+        { "enablevoicemail", FIELD_ENABLE_VOICEMAIL, & UserInfo::m_enablevoicemail },
+        { "incallfilter", FIELD_INCALL_FILTER, & UserInfo::m_incallfilter },
+        { "enablednd", FIELD_ENABLE_DND, & UserInfo::m_enablednd },
+        { "enableunc", FIELD_ENABLE_UNC, & UserInfo::m_enableunc },
+        { "enablerna", FIELD_ENABLE_RNA, & UserInfo::m_enablerna },
+        { "enablebusy", FIELD_ENABLE_BUSY, & UserInfo::m_enablebusy }
+    };
+    static const XInfoFieldTable<UserInfo> table(fields, bool_fields);
+
+    quint32 changed = table.update(this, prop);
+    if (changed & FIELD_VOICEMAIL_ID) {
+        m_xvoicemailid = QString("%1/%2").arg(m_ipbxid).arg(m_voicemailid);
+    }
+    if (changed & FIELD_AGENT_ID) {
+        m_xagentid = QString("%1/%2").arg(m_ipbxid).arg(m_agentid);
+    }
 
     if (prop.contains("linelist")) {
         QStringList lid;
@@ -71,19 +83,22 @@ bool UserInfo::updateConfig(const QVariantMap & prop)
             lid << QString("%1/%2").arg(m_ipbxid).arg(phone_id);
         lid.sort();
         if (lid != m_phoneidlist) {
-            haschanged = true;
+            changed |= FIELD_PHONE_LIST;
             m_phoneidlist = lid;
         }
     }
 
-    return haschanged;
+    return changed;
 }
 
-bool UserInfo::updateStatus(const QVariantMap & prop)
+quint32 UserInfo::updateStatus(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "availstate", & m_availstate);
-    return haschanged;
+    static const XInfoField<UserInfo, QString> fields[] = {
+        { "availstate", FIELD_AVAILSTATE, & UserInfo::m_availstate }
+    };
+    static const XInfoFieldTable<UserInfo> table(fields);
+
+    return table.update(this, prop);
 }
 
 const QString & UserInfo::availstate() const
@@ -37,6 +37,28 @@
 class BASELIB_EXPORT UserInfo : public XInfo
 {
     public:
+        //! bits of the change masks returned by updateConfig and updateStatus
+        enum Field {
+            FIELD_FULLNAME = 1 << 0,
+            FIELD_FIRSTNAME = 1 << 1,
+            FIELD_LASTNAME = 1 << 2,
+            FIELD_VOICEMAIL_ID = 1 << 3,
+            FIELD_AGENT_ID = 1 << 4,
+            FIELD_MOBILE_NUMBER = 1 << 5,
+            FIELD_ENABLE_VOICEMAIL = 1 << 6,
+            FIELD_INCALL_FILTER = 1 << 7,
+            FIELD_ENABLE_DND = 1 << 8,
+            FIELD_ENABLE_UNC = 1 << 9,
+            FIELD_DEST_UNC = 1 << 10,
+            FIELD_ENABLE_RNA = 1 << 11,
+            FIELD_DEST_RNA = 1 << 12,
+            FIELD_ENABLE_BUSY = 1 << 13,
+            FIELD_DEST_BUSY = 1 << 14,
+            FIELD_XIVO_UUID = 1 << 15,
+            FIELD_PHONE_LIST = 1 << 16,
+            FIELD_AVAILSTATE = 1 << 17
+        };
+
         UserInfo(const QString &, const QString &);
 
         const QString & fullname() const { return m_fullname; };
@@ -62,8 +84,8 @@ class BASELIB_EXPORT UserInfo : public XInfo
 
         const QString & availstate() const;
 
-        bool updateConfig(const QVariantMap &);
-        bool updateStatus(const QVariantMap &);
+        quint32 updateConfig(const QVariantMap &);
+        quint32 updateStatus(const QVariantMap &);
 
         void setAvailState(const QString & availstate) {m_availstate = availstate;};
 
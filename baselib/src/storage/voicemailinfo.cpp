@@ -36,17 +36,23 @@ VoiceMailInfo::VoiceMailInfo(const QString & ipbxid,
 {
 }
 
-bool VoiceMailInfo::updateConfig(const QVariantMap & prop)
+quint32 VoiceMailInfo::updateConfig(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeString(prop, "context", & m_context);
-    haschanged |= setIfChangeString(prop, "mailbox", & m_mailbox);
-    return haschanged;
+    static const XInfoField<VoiceMailInfo, QString> fields[] = {
+        { "context", FIELD_CONTEXT, & VoiceMailInfo::m_context },
+        { "mailbox", FIELD_MAILBOX, & VoiceMailInfo::m_mailbox }
+    };
+    static const XInfoFieldTable<VoiceMailInfo> table(fields);
+
+    return table.update(this, prop);
 }
 
-bool VoiceMailInfo::updateStatus(const QVariantMap & prop)
+quint32 VoiceMailInfo::updateStatus(const QVariantMap & prop)
 {
-    bool haschanged = false;
-    haschanged |= setIfChangeInt(prop, "new", & m_new);
-    return haschanged;
+    static const XInfoField<VoiceMailInfo, int> fields[] = {
+        { "new", FIELD_NEW_MESSAGES, & VoiceMailInfo::m_new }
+    };
+    static const XInfoFieldTable<VoiceMailInfo> table(fields);
+
+    return table.update(this, prop);
 }
@@ -40,9 +40,16 @@
 class BASELIB_EXPORT VoiceMailInfo : public XInfo
 {
     public:
+        //! bits of the change masks returned by updateConfig and updateStatus
+        enum Field {
+            FIELD_CONTEXT = 1 << 0,
+            FIELD_MAILBOX = 1 << 1,
+            FIELD_NEW_MESSAGES = 1 << 2
+        };
+
         VoiceMailInfo(const QString &, const QString &);  //! constructor
-        bool updateConfig(const QVariantMap &);  //! update config members
-        bool updateStatus(const QVariantMap &);  //! update status members
+        quint32 updateConfig(const QVariantMap &);  //! update config members
+        quint32 updateStatus(const QVariantMap &);  //! update status members
 
         const QString & context() const { return m_context; };
         const QString & mailbox() const { return m_mailbox; };
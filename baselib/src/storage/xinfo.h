@@ -31,6 +31,7 @@
 #define __XINFO_H__
 
 #include "baselib_export.h"
+#include <QHash>
 #include <QString>
 #include <QStringList>
 #include <QVariant>
@@ -41,10 +42,6 @@ class BASELIB_EXPORT XInfo
     public:
         XInfo(const QString &, const QString &);  //!< constructor
         virtual ~XInfo() {};
-        bool setIfChangeString(const QVariantMap &, const char * const, QString * const);
-        bool setIfChangeBool(const QVariantMap &, const char * const, bool * const);
-        bool setIfChangeInt(const QVariantMap &, const char * const, int * const);
-        bool setIfChangeDouble(const QVariantMap &, const char * const, double * const);
 
         //! IPBX this object belongs to
         const QString & ipbxid() const { return m_ipbxid; };
@@ -52,11 +49,15 @@ class BASELIB_EXPORT XInfo
         const QString & id() const { return m_id; };
         //! reference xid of this object
         const QString & xid() const { return m_xid; };
+        //! xid of the object id on the IPBX ipbxid
+        static QString makeXid(const QString &ipbxid, const QString &id);
 
-        //! update config members
-        virtual bool updateConfig(const QVariantMap &) { return false; };
-        //! update status members
-        virtual bool updateStatus(const QVariantMap &) { return false; };
+        //! update config members, returns the bits of the changed fields
+        virtual quint32 updateConfig(const QVariantMap &) { return 0; };
+        //! update status members, returns the bits of the changed fields
+        virtual quint32 updateStatus(const QVariantMap &) { return 0; };
+
+        static const quint32 AllFields = 0xffffffff;  //!< change mask when the changes are unknown
     protected:
         QString m_ipbxid;
         QString m_id;
@@ -64,6 +65,90 @@ class BASELIB_EXPORT XInfo
 };
 
 
+/*! \brief Where a field of type V received from the CTI server is stored in a T
+ *
+ * Fields of different types go in different tables:
+ *   { "number", PhoneInfo::FIELD_NUMBER, & PhoneInfo::m_number }
+ *   { "new", VoiceMailInfo::FIELD_NEW_MESSAGES, & VoiceMailInfo::m_new }
+ */
+template <class T, class V>
+struct XInfoField
+{
+    const char *key;
+    quint32 bit;                    //!< reported in the change mask
+    V T::*member;
+
+    //! store value in object, returns true if the member changed
+    static bool assign(const void *field, T *object, const QVariant &value)
+    {
+        V &member = object->*(static_cast<const XInfoField<T, V> *>(field)->member);
+        V converted = value.value<V>();
+        if (member == converted) {
+            return false;
+        }
+        member = converted;
+        return true;
+    }
+};
+
+/*! \brief Decode the fields of a config or status message in one pass
+ *
+ * The keys of the field tables are converted to QString once, when the
+ * table is built, and each key of the message is looked up once instead
+ * of looking up every field of the tables in the message.
+ */
+template <class T>
+class XInfoFieldTable
+{
+    public:
+        template <class V, int N>
+        XInfoFieldTable(const XInfoField<T, V> (&fields)[N])
+        {
+            this->add(fields);
+        };
+
+        template <class V, int N, class W, int M>
+        XInfoFieldTable(const XInfoField<T, V> (&fields)[N],
+                        const XInfoField<T, W> (&other_fields)[M])
+        {
+            this->add(fields);
+            this->add(other_fields);
+        };
+
+        //! update object from prop, returns the bits of the changed fields
+        quint32 update(T *object, const QVariantMap &prop) const
+        {
+            quint32 changed = 0;
+            QVariantMap::const_iterator it;
+            for (it = prop.constBegin(); it != prop.constEnd(); ++it) {
+                typename QHash<QString, Entry>::const_iterator entry = m_fields.constFind(it.key());
+                if (entry != m_fields.constEnd() && entry->assign(entry->field, object, it.value())) {
+                    changed |= entry->bit;
+                }
+            }
+            return changed;
+        };
+
+    private:
+        struct Entry {
+            const void *field;
+            quint32 bit;
+            bool (*assign)(const void *field, T *object, const QVariant &value);
+        };
+
+        template <class V, int N>
+        void add(const XInfoField<T, V> (&fields)[N])
+        {
+            m_fields.reserve(m_fields.size() + N);
+            for (int i = 0; i < N; ++i) {
+                Entry entry = { &fields[i], fields[i].bit, &XInfoField<T, V>::assign };
+                m_fields.insert(QString::fromLatin1(fields[i].key), entry);
+            }
+        };
+
+        QHash<QString, Entry> m_fields;
+};
+
 template <class T>
 XInfo * newXInfo(const QString & ipbxid,
                  const QString & id)
@@ -73,4 +158,37 @@ XInfo * newXInfo(const QString & ipbxid,
 
 typedef XInfo* (*newXInfoProto)(const QString &, const QString &);
 
+/*! \brief Read-only view over one of the lists stored by BaseEngine
+ *
+ * Iterating yields the stored objects directly, without copying the list
+ * or looking each object up again by its xid.
+ */
+template <class T>
+class XInfoList
+{
+    public:
+        class const_iterator
+        {
+            public:
+                const_iterator() {};
+                const_iterator(QHash<QString, XInfo *>::const_iterator it) : m_it(it) {};
+                const T * operator*() const { return static_cast<const T *>(m_it.value()); };
+                const QString & key() const { return m_it.key(); };
+                const_iterator & operator++() { ++m_it; return *this; };
+                bool operator==(const const_iterator &other) const { return m_it == other.m_it; };
+                bool operator!=(const const_iterator &other) const { return m_it != other.m_it; };
+            private:
+                QHash<QString, XInfo *>::const_iterator m_it;
+        };
+
+        XInfoList(const QHash<QString, XInfo *> &list) : m_list(&list) {};
+        const_iterator begin() const { return const_iterator(m_list->constBegin()); };
+        const_iterator end() const { return const_iterator(m_list->constEnd()); };
+        int size() const { return m_list->size(); };
+        bool contains(const QString &xid) const { return m_list->contains(xid); };
+        const T * value(const QString &xid) const { return static_cast<const T *>(m_list->value(xid)); };
+    private:
+        const QHash<QString, XInfo *> *m_list;
+};
+
 #endif
@@ -0,0 +1,227 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "xinfo_index.h"
+
+XInfoIndex::XInfoIndex()
+    : m_generation(0),
+      m_queues_generation(0)
+{
+}
+
+void XInfoIndex::updateAgent(const QString &agent_xid, const QString &agent_number)
+{
+    this->removeAgent(agent_xid);
+    m_agent_numbers[agent_xid] = agent_number;
+    m_agents_by_number[agent_number] = agent_xid;
+}
+
+void XInfoIndex::removeAgent(const QString &agent_xid)
+{
+    if (! m_agent_numbers.contains(agent_xid)) {
+        return;
+    }
+    const QString &agent_number = m_agent_numbers.take(agent_xid);
+    if (m_agents_by_number.value(agent_number) == agent_xid) {
+        m_agents_by_number.remove(agent_number);
+    }
+}
+
+void XInfoIndex::updatePhone(const QString &phone_xid, const QString &identity)
+{
+    // also called on every phone status update, which keeps the identity
+    QHash<QString, QString>::const_iterator indexed = m_phone_identities.constFind(phone_xid);
+    if (indexed != m_phone_identities.constEnd() && indexed.value() == identity) {
+        return;
+    }
+    this->removePhone(phone_xid);
+    m_phone_identities[phone_xid] = identity;
+    m_phones_by_identity[identity] = phone_xid;
+}
+
+void XInfoIndex::removePhone(const QString &phone_xid)
+{
+    if (! m_phone_identities.contains(phone_xid)) {
+        return;
+    }
+    const QString &identity = m_phone_identities.take(phone_xid);
+    if (m_phones_by_identity.value(identity) == phone_xid) {
+        m_phones_by_identity.remove(identity);
+    }
+}
+
+void XInfoIndex::updateQueue(const QString &queue_xid, const QString &queue_name)
+{
+    // also called on every queue status update, which keeps the name
+    QHash<QString, QString>::const_iterator indexed = m_queue_names.constFind(queue_xid);
+    if (indexed != m_queue_names.constEnd() && indexed.value() == queue_name) {
+        return;
+    }
+    this->removeQueue(queue_xid);
+    m_queue_names[queue_xid] = queue_name;
+    m_queues_by_name[queue_name] = queue_xid;
+    m_queues_generation = ++m_generation;
+}
+
+void XInfoIndex::removeQueue(const QString &queue_xid)
+{
+    if (! m_queue_names.contains(queue_xid)) {
+        return;
+    }
+    const QString &queue_name = m_queue_names.take(queue_xid);
+    if (m_queues_by_name.value(queue_name) == queue_xid) {
+        m_queues_by_name.remove(queue_name);
+    }
+    m_queues_generation = ++m_generation;
+}
+
+void XInfoIndex::updateQueueMember(const QString &queue_member_xid,
+                                   const QString &queue_name,
+                                   const QString &agent_number,
+                                   bool is_agent)
+{
+    // also called on every queue member status update, which keeps the key
+    QHash<QString, QueueMemberKey>::const_iterator indexed = m_queue_member_keys.constFind(queue_member_xid);
+    if (indexed != m_queue_member_keys.constEnd()
+        && indexed.value().queue_name == queue_name
+        && indexed.value().agent_number == agent_number
+        && indexed.value().is_agent == is_agent) {
+        return;
+    }
+    this->removeQueueMember(queue_member_xid);
+
+    QueueMemberKey key;
+    key.queue_name = queue_name;
+    key.agent_number = agent_number;
+    key.is_agent = is_agent;
+    m_queue_member_keys[queue_member_xid] = key;
+
+    if (is_agent) {
+        m_queue_members[AgentQueue(agent_number, queue_name)] = queue_member_xid;
+        m_queue_members_by_agent.insert(agent_number, queue_member_xid);
+        m_agent_members_generations[agent_number] = ++m_generation;
+        ++m_agent_counts[queue_name];
+    } else {
+        ++m_non_agent_counts[queue_name];
+    }
+}
+
+/*! \brief tell the caches of the agent of a queue member that the member changed
+ *
+ * For the values read from the member itself, such as its paused status,
+ * that do not move it in the index.
+ */
+void XInfoIndex::touchQueueMember(const QString &queue_member_xid)
+{
+    QHash<QString, QueueMemberKey>::const_iterator indexed = m_queue_member_keys.constFind(queue_member_xid);
+    if (indexed != m_queue_member_keys.constEnd() && indexed.value().is_agent) {
+        m_agent_members_generations[indexed.value().agent_number] = ++m_generation;
+    }
+}
+
+void XInfoIndex::removeQueueMember(const QString &queue_member_xid)
+{
+    if (! m_queue_member_keys.contains(queue_member_xid)) {
+        return;
+    }
+    const QueueMemberKey &key = m_queue_member_keys.take(queue_member_xid);
+
+    if (key.is_agent) {
+        AgentQueue agent_queue(key.agent_number, key.queue_name);
+        if (m_queue_members.value(agent_queue) == queue_member_xid) {
+            m_queue_members.remove(agent_queue);
+        }
+        m_queue_members_by_agent.remove(key.agent_number, queue_member_xid);
+        m_agent_members_generations[key.agent_number] = ++m_generation;
+        if (--m_agent_counts[key.queue_name] == 0) {
+            m_agent_counts.remove(key.queue_name);
+        }
+    } else {
+        if (--m_non_agent_counts[key.queue_name] == 0) {
+            m_non_agent_counts.remove(key.queue_name);
+        }
+    }
+}
+
+void XInfoIndex::clear()
+{
+    m_agent_numbers.clear();
+    m_agents_by_number.clear();
+    m_phone_identities.clear();
+    m_phones_by_identity.clear();
+    m_queue_names.clear();
+    m_queues_by_name.clear();
+    m_queue_member_keys.clear();
+    m_queue_members.clear();
+    m_queue_members_by_agent.clear();
+    m_agent_counts.clear();
+    m_non_agent_counts.clear();
+    m_agent_members_generations.clear();
+    m_queues_generation = ++m_generation;
+}
+
+QString XInfoIndex::agentFromNumber(const QString &agent_number) const
+{
+    return m_agents_by_number.value(agent_number);
+}
+
+QString XInfoIndex::phoneFromIdentity(const QString &identity) const
+{
+    return m_phones_by_identity.value(identity);
+}
+
+QString XInfoIndex::queueFromName(const QString &queue_name) const
+{
+    return m_queues_by_name.value(queue_name);
+}
+
+QString XInfoIndex::queueMember(const QString &agent_number, const QString &queue_name) const
+{
+    return m_queue_members.value(AgentQueue(agent_number, queue_name));
+}
+
+QStringList XInfoIndex::queueMembersFromAgentNumber(const QString &agent_number) const
+{
+    return m_queue_members_by_agent.values(agent_number);
+}
+
+int XInfoIndex::agentCount(const QString &queue_name) const
+{
+    return m_agent_counts.value(queue_name);
+}
+
+int XInfoIndex::nonAgentCount(const QString &queue_name) const
+{
+    return m_non_agent_counts.value(queue_name);
+}
+
+uint XInfoIndex::agentMembersGeneration(const QString &agent_number) const
+{
+    return m_agent_members_generations.value(agent_number, 0);
+}
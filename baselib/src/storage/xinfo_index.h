@@ -0,0 +1,105 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __XINFO_INDEX_H__
+#define __XINFO_INDEX_H__
+
+#include <QHash>
+#include <QPair>
+#include <QString>
+#include <QStringList>
+
+#include "baselib_export.h"
+
+/*! \brief Reverse lookups over the agents, phones, queues and queue members
+ *
+ * Kept up to date by BaseEngine each time one of these objects is
+ * configured, updated or deleted, so that finding an agent by number or a
+ * queue member by agent and queue does not scan the whole list.
+ *
+ * Generations tell the objects caching values derived from queues or
+ * queue members whether they changed since the values were computed.
+ */
+class BASELIB_EXPORT XInfoIndex
+{
+    public:
+        XInfoIndex();
+
+        void updateAgent(const QString &agent_xid, const QString &agent_number);
+        void removeAgent(const QString &agent_xid);
+        void updatePhone(const QString &phone_xid, const QString &identity);
+        void removePhone(const QString &phone_xid);
+        void updateQueue(const QString &queue_xid, const QString &queue_name);
+        void removeQueue(const QString &queue_xid);
+        void updateQueueMember(const QString &queue_member_xid,
+                               const QString &queue_name,
+                               const QString &agent_number,
+                               bool is_agent);
+        void touchQueueMember(const QString &queue_member_xid);
+        void removeQueueMember(const QString &queue_member_xid);
+        void clear();
+
+        QString agentFromNumber(const QString &agent_number) const;
+        QString phoneFromIdentity(const QString &identity) const;
+        QString queueFromName(const QString &queue_name) const;
+        QString queueMember(const QString &agent_number, const QString &queue_name) const;
+        QStringList queueMembersFromAgentNumber(const QString &agent_number) const;
+        int agentCount(const QString &queue_name) const;
+        int nonAgentCount(const QString &queue_name) const;
+
+        uint queuesGeneration() const { return m_queues_generation; };
+        uint agentMembersGeneration(const QString &agent_number) const;
+
+    private:
+        typedef QPair<QString, QString> AgentQueue;
+
+        struct QueueMemberKey {
+            QString queue_name;
+            QString agent_number;
+            bool is_agent;
+        };
+
+        QHash<QString, QString> m_agent_numbers;        //!< agent xid -> indexed agent number
+        QHash<QString, QString> m_agents_by_number;     //!< agent number -> agent xid
+        QHash<QString, QString> m_phone_identities;     //!< phone xid -> indexed line interface
+        QHash<QString, QString> m_phones_by_identity;   //!< line interface -> phone xid
+        QHash<QString, QString> m_queue_names;          //!< queue xid -> indexed queue name
+        QHash<QString, QString> m_queues_by_name;       //!< queue name -> queue xid
+        QHash<QString, QueueMemberKey> m_queue_member_keys;        //!< member xid -> indexed key
+        QHash<AgentQueue, QString> m_queue_members;                //!< (agent number, queue name) -> member xid
+        QMultiHash<QString, QString> m_queue_members_by_agent;     //!< agent number -> member xids
+        QHash<QString, int> m_agent_counts;             //!< queue name -> number of agent members
+        QHash<QString, int> m_non_agent_counts;         //!< queue name -> number of non agent members
+
+        uint m_generation;                              //!< incremented on every change, never reset
+        uint m_queues_generation;                       //!< m_generation when a queue last changed
+        QHash<QString, uint> m_agent_members_generations;  //!< agent number -> m_generation when one of its members last changed
+};
+
+#endif
@@ -0,0 +1,284 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QDateTime>
+#include <QHostAddress>
+#include <QJsonDocument>
+#include <QTcpSocket>
+
+#include "fake_cti_server.h"
+
+static const int QueueMembersPerAgent = 4;
+static const int AgentsPerQueue = 100;
+
+FakeCTIServer::FakeCTIServer(int nb_entities, bool getlist_batch)
+    : QObject(NULL),
+      m_socket(NULL),
+      m_nb_entities(nb_entities),
+      m_getlist_batch(getlist_batch),
+      m_received_count(0)
+{
+    connect(&m_server, SIGNAL(newConnection()),
+            this, SLOT(newConnection()));
+}
+
+bool FakeCTIServer::listen()
+{
+    return m_server.listen(QHostAddress::LocalHost);
+}
+
+quint16 FakeCTIServer::port() const
+{
+    return m_server.serverPort();
+}
+
+void FakeCTIServer::newConnection()
+{
+    m_socket = m_server.nextPendingConnection();
+    connect(m_socket, SIGNAL(readyRead()),
+            this, SLOT(readyRead()));
+}
+
+void FakeCTIServer::readyRead()
+{
+    while (m_socket->canReadLine()) {
+        QByteArray line = m_socket->readLine();
+        ++m_received_count;
+        this->reply(QJsonDocument::fromJson(line).toVariant().toMap());
+    }
+}
+
+void FakeCTIServer::reply(const QVariantMap &command)
+{
+    const QString &thisclass = command.value("class").toString();
+    QVariantMap message;
+    message["class"] = thisclass;
+
+    if (thisclass == "login_id") {
+        message["sessionid"] = "fake";
+    } else if (thisclass == "login_pass") {
+        message["capalist"] = QStringList() << "1";
+    } else if (thisclass == "login_capas") {
+        message["ipbxid"] = "xivo";
+        message["userid"] = "1";
+        message["appliname"] = "Client";
+        message["capaxlets"] = QVariantList();
+        message["capas"] = QVariantMap();
+        message["getlist_batch"] = m_getlist_batch;
+    } else if (thisclass == "getipbxlist") {
+        message["ipbxlist"] = QStringList() << "xivo";
+    } else if (thisclass == "getlist") {
+        this->replyGetlist(command);
+        return;
+    } else {
+        return;
+    }
+    this->send(message);
+}
+
+void FakeCTIServer::replyGetlist(const QVariantMap &command)
+{
+    const QString &function = command.value("function").toString();
+    const QString &listname = command.value("listname").toString();
+    const char *key = function == "updateconfig" ? "config" : "status";
+
+    QVariantMap message;
+    message["class"] = "getlist";
+    message["function"] = function;
+    message["listname"] = listname;
+    message["tipbxid"] = command.value("tipbxid");
+
+    if (function == "listid") {
+        message["list"] = this->ids(listname);
+    } else if (command.contains("tids")) {
+        QVariantList items;
+        foreach (const QString &id, command.value("tids").toStringList()) {
+            QVariantMap item;
+            item["tid"] = id;
+            item[key] = function == "updateconfig" ? this->config(listname, id) : this->status(listname, id);
+            items.append(item);
+        }
+        message["items"] = items;
+    } else {
+        const QString &id = command.value("tid").toString();
+        message["tid"] = id;
+        message[key] = function == "updateconfig" ? this->config(listname, id) : this->status(listname, id);
+    }
+    this->send(message);
+}
+
+void FakeCTIServer::send(const QVariantMap &message)
+{
+    QVariantMap full_message = message;
+    full_message["timenow"] = QDateTime::currentDateTime().toTime_t();
+    m_socket->write(QJsonDocument::fromVariant(full_message).toJson(QJsonDocument::Compact) + "\n");
+}
+
+void FakeCTIServer::sendConfig(const QString &listname, const QString &id)
+{
+    QVariantMap message;
+    message["class"] = "getlist";
+    message["function"] = "updateconfig";
+    message["listname"] = listname;
+    message["tipbxid"] = "xivo";
+    message["tid"] = id;
+    message["config"] = this->config(listname, id);
+    this->send(message);
+}
+
+void FakeCTIServer::sendStatus(const QString &listname, const QString &id, const QVariantMap &status)
+{
+    QVariantMap message;
+    message["class"] = "getlist";
+    message["function"] = "updatestatus";
+    message["listname"] = listname;
+    message["tipbxid"] = "xivo";
+    message["tid"] = id;
+    message["status"] = status;
+    this->send(message);
+}
+
+/*! \brief write agent status changes the way a busy call center sends them
+ *
+ * The messages are written at once so the client reads them in whatever
+ * chunks the socket hands out.
+ */
+void FakeCTIServer::sendStatusBurst(int nb_messages)
+{
+    static const char *availabilities[] = {"available", "on_call_nonacd_incoming_internal", "unavailable"};
+    QByteArray burst;
+    for (int i = 0; i < nb_messages; ++i) {
+        QVariantMap status;
+        status["availability"] = availabilities[i % 3];
+        status["availability_since"] = QDateTime::currentDateTime().toTime_t();
+
+        QVariantMap message;
+        message["class"] = "getlist";
+        message["function"] = "updatestatus";
+        message["listname"] = "agents";
+        message["tipbxid"] = "xivo";
+        message["tid"] = QString::number(i % m_nb_entities + 1);
+        message["status"] = status;
+        message["timenow"] = QDateTime::currentDateTime().toTime_t();
+        burst.append(QJsonDocument::fromVariant(message).toJson(QJsonDocument::Compact) + "\n");
+    }
+    m_socket->write(burst);
+}
+
+/*! \brief number of entities served over all the lists */
+int FakeCTIServer::entityCount() const
+{
+    int count = 0;
+    foreach (const QString &listname, QStringList() << "users" << "phones" << "agents" << "queues" << "queuemembers") {
+        count += this->ids(listname).size();
+    }
+    return count;
+}
+
+QStringList FakeCTIServer::ids(const QString &listname) const
+{
+    int count = 0;
+    if (listname == "users" || listname == "phones" || listname == "agents") {
+        count = m_nb_entities;
+    } else if (listname == "queues") {
+        count = qMax(1, m_nb_entities / AgentsPerQueue);
+    } else if (listname == "queuemembers") {
+        count = m_nb_entities * QueueMembersPerAgent;
+    }
+
+    QStringList ret;
+    for (int i = 1; i <= count; ++i) {
+        ret << QString::number(i);
+    }
+    return ret;
+}
+
+QVariantMap FakeCTIServer::config(const QString &listname, const QString &id) const
+{
+    QVariantMap config;
+    if (listname == "users") {
+        config["firstname"] = "User";
+        config["lastname"] = id;
+        config["fullname"] = QString("User %1").arg(id);
+        config["agentid"] = id;
+        config["linelist"] = QStringList() << id;
+    } else if (listname == "phones") {
+        config["number"] = QString::number(1000 + id.toInt());
+        config["identity"] = QString("SIP/line%1").arg(id);
+        config["iduserfeatures"] = id;
+    } else if (listname == "agents") {
+        config["number"] = QString::number(1000 + id.toInt());
+        config["firstname"] = "Agent";
+        config["lastname"] = id;
+        config["context"] = "default";
+    } else if (listname == "queues") {
+        config["name"] = QString("queue%1").arg(id);
+        config["displayname"] = QString("Queue %1").arg(id);
+        config["number"] = QString::number(3000 + id.toInt());
+        config["context"] = "default";
+    } else if (listname == "queuemembers") {
+        int member = id.toInt() - 1;
+        int agent = member / QueueMembersPerAgent + 1;
+        config["queue_name"] = QString("queue%1").arg(this->memberQueue(agent, member % QueueMembersPerAgent));
+        config["interface"] = QString("Agent/%1").arg(1000 + agent);
+        config["membership"] = "static";
+        config["penalty"] = "0";
+    }
+    return config;
+}
+
+QVariantMap FakeCTIServer::status(const QString &listname, const QString &id) const
+{
+    QVariantMap status;
+    if (listname == "users") {
+        status["availstate"] = "available";
+    } else if (listname == "phones") {
+        status["hintstatus"] = "0";
+    } else if (listname == "agents") {
+        QStringList queues;
+        for (int i = 0; i < QueueMembersPerAgent; ++i) {
+            queues << QString::number(this->memberQueue(id.toInt(), i));
+        }
+        status["availability"] = "available";
+        status["availability_since"] = QDateTime::currentDateTime().toTime_t();
+        status["queues"] = queues;
+    } else if (listname == "queuemembers") {
+        status["status"] = "1";
+        status["paused"] = id.toInt() % 3 == 0 ? "1" : "0";
+        status["callstaken"] = "0";
+    }
+    return status;
+}
+
+/*! \brief id of the queue of the nth member of an agent */
+int FakeCTIServer::memberQueue(int agent, int nth_member) const
+{
+    int nb_queues = qMax(1, m_nb_entities / AgentsPerQueue);
+    return (agent + nth_member) % nb_queues + 1;
+}
@@ -0,0 +1,79 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __FAKE_CTI_SERVER_H__
+#define __FAKE_CTI_SERVER_H__
+
+#include <QObject>
+#include <QStringList>
+#include <QTcpServer>
+#include <QVariantMap>
+
+class QTcpSocket;
+
+/*! \brief Minimal CTI server answering the login and getlist bootstrap
+ *
+ * Serves synthetic users, phones, agents, queues and queue members on
+ * 127.0.0.1 so that a BaseEngine can be logged in without a real XiVO.
+ */
+class FakeCTIServer: public QObject
+{
+    Q_OBJECT
+
+    public:
+        FakeCTIServer(int nb_entities, bool getlist_batch);
+        bool listen();
+        quint16 port() const;
+        int receivedCount() const { return m_received_count; };
+        int entityCount() const;
+        void sendStatusBurst(int nb_messages);
+        void sendConfig(const QString &listname, const QString &id);
+        void sendStatus(const QString &listname, const QString &id, const QVariantMap &status);
+
+    private slots:
+        void newConnection();
+        void readyRead();
+
+    private:
+        void reply(const QVariantMap &command);
+        void replyGetlist(const QVariantMap &command);
+        void send(const QVariantMap &message);
+        QStringList ids(const QString &listname) const;
+        QVariantMap config(const QString &listname, const QString &id) const;
+        QVariantMap status(const QString &listname, const QString &id) const;
+        int memberQueue(int agent, int nth_member) const;
+
+        QTcpServer m_server;
+        QTcpSocket *m_socket;
+        int m_nb_entities;
+        bool m_getlist_batch;
+        int m_received_count;
+};
+
+#endif
@@ -0,0 +1,66 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QSettings>
+#include <QSignalSpy>
+
+#include <baseengine.h>
+
+#include "logged_engine.h"
+
+LoggedEngine::LoggedEngine(quint16 port)
+{
+    m_settings_file.open();
+    QSettings *settings = new QSettings(m_settings_file.fileName(), QSettings::IniFormat);
+
+    m_engine = new BaseEngine(settings, "linux");
+    b_engine = m_engine;
+
+    QVariantMap config;
+    config["cti_address"] = "127.0.0.1";
+    config["cti_port"] = port;
+    config["cti_encrypt"] = false;
+    config["userlogin"] = "alice";
+    config["password"] = "secret";
+    m_engine->setConfig(config);
+}
+
+LoggedEngine::~LoggedEngine()
+{
+    m_engine->stop();
+    delete m_engine;
+    b_engine = NULL;
+}
+
+bool LoggedEngine::login(int timeout)
+{
+    QSignalSpy spy(m_engine, SIGNAL(initialized()));
+    m_engine->start();
+    return spy.wait(timeout);
+}
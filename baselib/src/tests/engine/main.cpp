@@ -0,0 +1,58 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QCoreApplication>
+#include <QtTest/QtTest>
+
+#include "test_agent_stats.h"
+#include "test_bootstrap.h"
+#include "test_status_coalescer.h"
+#include "test_status_replay.h"
+#include "test_update_router.h"
+
+// To run the tests use
+// export LD_LIBRARY_PATH=../../bin
+// ./tests
+
+int main (int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    TestAgentStats test_agent_stats;
+    TestBootstrap test_bootstrap;
+    TestStatusCoalescer test_status_coalescer;
+    TestStatusReplay test_status_replay;
+    TestUpdateRouter test_update_router;
+
+    QTest::qExec(&test_bootstrap, argc, argv);
+    QTest::qExec(&test_status_coalescer, argc, argv);
+    QTest::qExec(&test_status_replay, argc, argv);
+    QTest::qExec(&test_agent_stats, argc, argv);
+    QTest::qExec(&test_update_router, argc, argv);
+    return 0;
+}
@@ -0,0 +1,138 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include <baseengine.h>
+#include <storage/agentinfo.h>
+
+#include "fake_cti_server.h"
+#include "logged_engine.h"
+#include "test_agent_stats.h"
+
+static const int NbAgents = 500;
+static const int LoginTimeout = 60000;
+
+static int readStats(const AgentInfo *agent)
+{
+    return agent->joinedQueueCount()
+        + agent->pausedQueueCount()
+        + agent->paused()
+        + agent->joinedQueueNames().size()
+        + agent->pausedQueueNames().size();
+}
+
+void TestAgentStats::initTestCase()
+{
+    m_server = new FakeCTIServer(NbAgents, true);
+    QVERIFY(m_server->listen());
+    m_engine = new LoggedEngine(m_server->port());
+    QVERIFY(m_engine->login(LoginTimeout));
+}
+
+void TestAgentStats::cleanupTestCase()
+{
+    delete m_engine;
+    delete m_server;
+}
+
+void TestAgentStats::testStatsFromQueueMembers()
+{
+    // queue members 1 to 4 belong to agent 1, member 3 is paused
+    const AgentInfo *agent = b_engine->agent("xivo/1");
+    QVERIFY(agent != NULL);
+
+    QCOMPARE(agent->joinedQueueCount(), 4);
+    QCOMPARE(agent->joinedQueueNames().size(), 4);
+    QCOMPARE(agent->pausedQueueCount(), 1);
+    QCOMPARE(agent->pausedQueueNames().size(), 1);
+    QVERIFY(agent->paused());
+    QCOMPARE(agent->pausedStatus(), PARTIALLY_PAUSED);
+}
+
+void TestAgentStats::testStatsFollowQueueMemberChanges()
+{
+    // queue members 5 to 8 belong to agent 2, member 6 is paused
+    const AgentInfo *agent = b_engine->agent("xivo/2");
+    QVERIFY(agent != NULL);
+    QCOMPARE(agent->pausedQueueCount(), 1);
+
+    QVariantMap status;
+    status["paused"] = "0";
+    m_server->sendStatus("queuemembers", "6", status);
+    QTRY_COMPARE(agent->pausedQueueCount(), 0);
+    QCOMPARE(agent->pausedStatus(), UNPAUSED);
+
+    status["paused"] = "1";
+    m_server->sendStatus("queuemembers", "6", status);
+    QTRY_COMPARE(agent->pausedQueueCount(), 1);
+}
+
+/*! \brief cost of reading the queue values of every agent, as a view paints them
+ *
+ * The first pass computes the values from the queue members, the next ones
+ * are served from the cache of each agent.
+ */
+void TestAgentStats::benchmarkStats()
+{
+    QList<const AgentInfo *> agents;
+    foreach (const AgentInfo *agent, b_engine->agents()) {
+        agents.append(agent);
+    }
+
+    // a queue change invalidates the values of every agent
+    m_server->sendConfig("queues", "1");
+    QTest::qWait(100);
+
+    QElapsedTimer timer;
+    timer.start();
+    int total = 0;
+    foreach (const AgentInfo *agent, agents) {
+        total += readStats(agent);
+    }
+    qint64 cold = timer.nsecsElapsed();
+
+    timer.restart();
+    foreach (const AgentInfo *agent, agents) {
+        total += readStats(agent);
+    }
+    qint64 warm = timer.nsecsElapsed();
+
+    qDebug() << "agent queue values, computed:" << cold / agents.size() << "ns/agent"
+             << "cached:" << warm / agents.size() << "ns/agent";
+    QVERIFY(total > 0);
+
+    QBENCHMARK {
+        foreach (const AgentInfo *agent, agents) {
+            readStats(agent);
+        }
+    }
+}
@@ -1,4 +1,7 @@
-/* Copyright (C) 2007-2014 Avencall
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
  *
  * XiVO Client is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -24,24 +27,31 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef __AGENT_STATUS_WIDGET_STORAGE_H__
-#define __AGENT_STATUS_WIDGET_STORAGE_H__
+#ifndef __TEST_AGENT_STATS__
+#define __TEST_AGENT_STATS__
 
-#include <QHash>
+#include <QObject>
 
-class AgentStatusWidget;
-class QModelIndex;
-class AgentStatusWidgetBuilder;
+class FakeCTIServer;
+class LoggedEngine;
 
-class AgentStatusWidgetStorage
+class TestAgentStats: public QObject
 {
+    Q_OBJECT
+
     public:
-        AgentStatusWidgetStorage(AgentStatusWidgetBuilder * builder);
-        virtual ~AgentStatusWidgetStorage();
-        AgentStatusWidget * getWidget(const QModelIndex & index);
+
+    private slots:
+        void initTestCase();
+        void cleanupTestCase();
+
+        void testStatsFromQueueMembers();
+        void testStatsFollowQueueMemberChanges();
+        void benchmarkStats();
+
     private:
-        AgentStatusWidgetBuilder * m_builder;
-        QHash<QString, AgentStatusWidget *> m_widgets;
+        FakeCTIServer *m_server;
+        LoggedEngine *m_engine;
 };
 
 #endif
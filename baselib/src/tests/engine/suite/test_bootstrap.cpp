@@ -0,0 +1,80 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+#include <QDebug>
+#include <QElapsedTimer>
+
+#include "fake_cti_server.h"
+#include "logged_engine.h"
+#include "test_bootstrap.h"
+
+static const int NbEntities = 500;
+static const int LoginTimeout = 60000;
+
+bool TestBootstrap::login(bool getlist_batch, int *request_count)
+{
+    FakeCTIServer server(NbEntities, getlist_batch);
+    if (! server.listen()) {
+        return false;
+    }
+
+    LoggedEngine engine(server.port());
+    QElapsedTimer timer;
+    timer.start();
+    bool initialized = engine.login(LoginTimeout);
+
+    qDebug() << (getlist_batch ? "batched" : "per id") << "bootstrap of" << NbEntities << "entities:"
+             << timer.elapsed() << "ms" << server.receivedCount() << "requests";
+
+    *request_count = server.receivedCount();
+    return initialized;
+}
+
+void TestBootstrap::testPerIdBootstrap()
+{
+    int request_count = 0;
+
+    QVERIFY(this->login(false, &request_count));
+
+    // one updateconfig and one updatestatus request per entity
+    FakeCTIServer server(NbEntities, false);
+    QVERIFY(request_count >= 2 * server.entityCount());
+}
+
+void TestBootstrap::testBatchedBootstrap()
+{
+    int per_id_request_count = 0;
+    int batched_request_count = 0;
+
+    QVERIFY(this->login(false, &per_id_request_count));
+    QVERIFY(this->login(true, &batched_request_count));
+
+    QVERIFY(batched_request_count < per_id_request_count / 10);
+}
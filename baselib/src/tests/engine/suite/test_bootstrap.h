@@ -1,4 +1,7 @@
-/* Copyright (C) 2007-2014 Avencall
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
  *
  * XiVO Client is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -24,22 +27,23 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef __AGENT_STATUS_WIDGET_BUILDER_H__
-#define __AGENT_STATUS_WIDGET_BUILDER_H__
-
-#include "ui_agent_status.h"
+#ifndef __TEST_BOOTSTRAP__
+#define __TEST_BOOTSTRAP__
 
-class AgentStatusWidget;
+#include <QObject>
 
-class AgentStatusWidgetBuilder
+class TestBootstrap: public QObject
 {
+    Q_OBJECT
+
     public:
-        AgentStatusWidgetBuilder();
-        ~AgentStatusWidgetBuilder();
-        AgentStatusWidget * build();
+
+    private slots:
+        void testPerIdBootstrap();
+        void testBatchedBootstrap();
 
     private:
-        Ui::AgentStatus widget_ui;
+        bool login(bool getlist_batch, int *request_count);
 };
 
-#endif /* __AGENT_STATUS_DASHBOARD_H__ */
+#endif
@@ -0,0 +1,142 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QSignalSpy>
+#include <QtTest/QtTest>
+
+#include <status_coalescer.h>
+
+#include "test_status_coalescer.h"
+
+void TestStatusCoalescer::initTestCase()
+{
+    // QSignalSpy needs it to copy the arguments of flushed()
+    qRegisterMetaType<QSet<QString> >("QSet<QString>");
+}
+
+void TestStatusCoalescer::testFlushesOnNextIteration()
+{
+    StatusCoalescer coalescer;
+    QSignalSpy spy(&coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)));
+
+    coalescer.markDirty("agents", "xivo/1");
+    coalescer.markDirty("agents", "xivo/2");
+    coalescer.markDirty("agents", "xivo/1");
+
+    QCOMPARE(spy.count(), 0);
+    QVERIFY(coalescer.isPending());
+    QVERIFY(spy.wait(1000));
+
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(spy.at(0).at(0).toString(), QString("agents"));
+    QSet<QString> expected_xids;
+    expected_xids << "xivo/1" << "xivo/2";
+    QCOMPARE(qvariant_cast<QSet<QString> >(spy.at(0).at(1)), expected_xids);
+    QVERIFY(! coalescer.isPending());
+}
+
+void TestStatusCoalescer::testGroupsByList()
+{
+    StatusCoalescer coalescer;
+    QSignalSpy spy(&coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)));
+
+    coalescer.markDirty("phones", "xivo/1");
+    coalescer.markDirty("agents", "xivo/1");
+    coalescer.markDirty("phones", "xivo/2");
+    coalescer.flush();
+
+    QCOMPARE(spy.count(), 2);
+    QCOMPARE(spy.at(0).at(0).toString(), QString("phones"));
+    QCOMPARE(qvariant_cast<QSet<QString> >(spy.at(0).at(1)).size(), 2);
+    QCOMPARE(spy.at(1).at(0).toString(), QString("agents"));
+    QCOMPARE(qvariant_cast<QSet<QString> >(spy.at(1).at(1)).size(), 1);
+}
+
+void TestStatusCoalescer::testMergesFields()
+{
+    StatusCoalescer coalescer;
+    QSignalSpy spy(&coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)));
+
+    coalescer.markDirty("agents", "xivo/1", 0x1);
+    coalescer.markDirty("agents", "xivo/2", 0x4);
+    coalescer.markDirty("phones", "xivo/1");
+    coalescer.flush();
+    coalescer.markDirty("agents", "xivo/1", 0x2);
+    coalescer.flush();
+
+    QCOMPARE(spy.count(), 3);
+    QCOMPARE(spy.at(0).at(2).toUInt(), 0x5u);
+    QCOMPARE(spy.at(1).at(2).toUInt(), 0xffffffffu);
+    QCOMPARE(spy.at(2).at(2).toUInt(), 0x2u);
+}
+
+void TestStatusCoalescer::testWaitsForInterval()
+{
+    StatusCoalescer coalescer;
+    coalescer.setInterval(100);
+    QSignalSpy spy(&coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)));
+    QElapsedTimer elapsed;
+    elapsed.start();
+
+    coalescer.markDirty("users", "xivo/1");
+    QCoreApplication::processEvents();
+    coalescer.markDirty("users", "xivo/2");
+
+    QCOMPARE(spy.count(), 0);
+    QVERIFY(spy.wait(1000));
+    QVERIFY(elapsed.elapsed() >= 90);
+    QCOMPARE(spy.count(), 1);
+    QCOMPARE(qvariant_cast<QSet<QString> >(spy.at(0).at(1)).size(), 2);
+}
+
+void TestStatusCoalescer::testForget()
+{
+    StatusCoalescer coalescer;
+    QSignalSpy spy(&coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)));
+
+    coalescer.markDirty("queuemembers", "xivo/1");
+    coalescer.forget("queuemembers", "xivo/1");
+    coalescer.forget("agents", "xivo/1");
+    coalescer.flush();
+
+    QCOMPARE(spy.count(), 0);
+}
+
+void TestStatusCoalescer::testClear()
+{
+    StatusCoalescer coalescer;
+    QSignalSpy spy(&coalescer, SIGNAL(flushed(const QString &, const QSet<QString> &, quint32)));
+
+    coalescer.markDirty("agents", "xivo/1");
+    coalescer.clear();
+    QTest::qWait(50);
+
+    QCOMPARE(spy.count(), 0);
+    QVERIFY(! coalescer.isPending());
+}
@@ -0,0 +1,65 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+#include <QDebug>
+#include <QElapsedTimer>
+#include <QSignalSpy>
+
+#include <baseengine.h>
+
+#include "fake_cti_server.h"
+#include "logged_engine.h"
+#include "test_status_replay.h"
+
+static const int NbAgents = 500;
+static const int NbMessages = 20000;
+static const int Timeout = 60000;
+
+void TestStatusReplay::benchmarkAgentStatusBurst()
+{
+    FakeCTIServer server(NbAgents, true);
+    QVERIFY(server.listen());
+
+    LoggedEngine engine(server.port());
+    QVERIFY(engine.login(Timeout));
+
+    QSignalSpy updated(engine.engine(), SIGNAL(updateAgentStatus(const QString &, quint32)));
+    QElapsedTimer timer;
+    timer.start();
+    server.sendStatusBurst(NbMessages);
+    while (updated.count() < NbMessages && timer.elapsed() < Timeout) {
+        updated.wait(1000);
+    }
+    qint64 elapsed = qMax(qint64(1), timer.elapsed());
+
+    qDebug() << NbMessages << "agent status messages in" << elapsed << "ms:"
+             << NbMessages * 1000 / elapsed << "messages/s";
+    QCOMPARE(updated.count(), NbMessages);
+}
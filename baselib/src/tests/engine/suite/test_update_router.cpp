@@ -0,0 +1,108 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+
+#include <update_router.h>
+
+#include "test_update_router.h"
+
+void TestUpdateRouter::testRoutesSubscribedXids()
+{
+    UpdateRouter router;
+    UpdateReceiver receiver;
+
+    QVERIFY(router.subscribe("agents", UpdateRouter::STATUS, "xivo/1",
+                             &receiver, SLOT(update(const QString &))));
+
+    router.route("agents", UpdateRouter::STATUS, "xivo/2");
+    router.route("agents", UpdateRouter::CONFIG, "xivo/1");
+    router.route("phones", UpdateRouter::STATUS, "xivo/1");
+    router.route("agents", UpdateRouter::STATUS, "xivo/1");
+
+    QCOMPARE(receiver.received, QStringList() << "xivo/1");
+}
+
+void TestUpdateRouter::testPassesData()
+{
+    UpdateRouter router;
+    UpdateReceiver receiver;
+    QVariantMap data;
+    data["enablednd"] = true;
+
+    router.subscribe("users", UpdateRouter::CONFIG, "xivo/1",
+                     &receiver, SLOT(updateWithData(const QString &, const QVariantMap &)));
+    router.route("users", UpdateRouter::CONFIG, "xivo/1", data);
+
+    QCOMPARE(receiver.received.size(), 1);
+    QCOMPARE(receiver.last_data, data);
+}
+
+void TestUpdateRouter::testUnsubscribe()
+{
+    UpdateRouter router;
+    UpdateReceiver receiver;
+
+    router.subscribe("users", UpdateRouter::STATUS, "xivo/1", &receiver, SLOT(update(const QString &)));
+    router.subscribe("users", UpdateRouter::STATUS, "xivo/1", &receiver, SLOT(update(const QString &)));
+    router.subscribe("users", UpdateRouter::STATUS, "xivo/2", &receiver, SLOT(update(const QString &)));
+    QCOMPARE(router.subscriberCount("users", UpdateRouter::STATUS, "xivo/1"), 1);
+
+    router.unsubscribe("users", UpdateRouter::STATUS, "xivo/1", &receiver);
+    router.route("users", UpdateRouter::STATUS, "xivo/1");
+    router.route("users", UpdateRouter::STATUS, "xivo/2");
+    QCOMPARE(receiver.received, QStringList() << "xivo/2");
+
+    router.unsubscribe(&receiver);
+    router.route("users", UpdateRouter::STATUS, "xivo/2");
+    QCOMPARE(receiver.received.size(), 1);
+    QCOMPARE(router.subscriberCount("users", UpdateRouter::STATUS, "xivo/2"), 0);
+}
+
+void TestUpdateRouter::testReceiverDestroyed()
+{
+    UpdateRouter router;
+    UpdateReceiver *receiver = new UpdateReceiver();
+
+    router.subscribe("phones", UpdateRouter::CONFIG, "xivo/1", receiver, SLOT(update(const QString &)));
+    delete receiver;
+
+    QCOMPARE(router.subscriberCount("phones", UpdateRouter::CONFIG, "xivo/1"), 0);
+    router.route("phones", UpdateRouter::CONFIG, "xivo/1");
+}
+
+void TestUpdateRouter::testUnknownSlot()
+{
+    UpdateRouter router;
+    UpdateReceiver receiver;
+
+    QVERIFY(! router.subscribe("phones", UpdateRouter::CONFIG, "xivo/1",
+                               &receiver, SLOT(unknown(const QString &))));
+    QCOMPARE(router.subscriberCount("phones", UpdateRouter::CONFIG, "xivo/1"), 0);
+}
@@ -1,5 +1,5 @@
 /* XiVO Client
- * Copyright (C) 2007-2014 Avencall
+ * Copyright (C) 2016 Avencall
  *
  * This file is part of XiVO Client.
  *
@@ -27,24 +27,38 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#ifndef __AGENT_STATUS_SORT_FILTER_PROXY_MODEL_H__
-#define __AGENT_STATUS_SORT_FILTER_PROXY_MODEL_H__
+#ifndef __TEST_UPDATE_ROUTER__
+#define __TEST_UPDATE_ROUTER__
 
-#include <xletlib/abstract_sort_filter_proxy_model.h>
+#include <QObject>
+#include <QStringList>
+#include <QVariantMap>
 
-class QModelIndex;
+class UpdateReceiver: public QObject
+{
+    Q_OBJECT
+
+    public slots:
+        void update(const QString &xid) { received << xid; };
+        void updateWithData(const QString &xid, const QVariantMap &data) { received << xid; last_data = data; };
+
+    public:
+        QStringList received;
+        QVariantMap last_data;
+};
 
-class AgentStatusSortFilterProxyModel: public AbstractSortFilterProxyModel
+class TestUpdateRouter: public QObject
 {
-public:
-    AgentStatusSortFilterProxyModel(const QString &queue_id, QObject * parent = NULL);
-    virtual ~AgentStatusSortFilterProxyModel();
-protected:
-    bool filterAcceptsRow(int sourceRow, const QModelIndex & source_parent) const;
-    bool agentInQueue(int source_row, const QModelIndex & source_parent) const;
-    bool agentLogged(int source_row, const QModelIndex & source_parent) const;
-private:
-    QString m_queue_id;
+    Q_OBJECT
+
+    public:
+
+    private slots:
+        void testRoutesSubscribedXids();
+        void testPassesData();
+        void testUnsubscribe();
+        void testReceiverDestroyed();
+        void testUnknownSlot();
 };
 
 #endif
@@ -0,0 +1,25 @@
+include (../../../common-tests.pri)
+
+# Drives a real BaseEngine against a local fake CTI server
+
+TARGET = testsuite_engine
+
+QT += network
+
+SOURCES += $${ROOT_DIR}/src/tests/engine/main.cpp
+
+INCLUDEPATH += $${ROOT_DIR}/src/tests/engine
+INCLUDEPATH += $${ROOT_DIR}/src/tests/engine/suite
+
+INCLUDEPATH += $${ROOT_DIR}/src
+
+HEADERS += $${ROOT_DIR}/src/tests/engine/fake_cti_server.h
+SOURCES += $${ROOT_DIR}/src/tests/engine/fake_cti_server.cpp
+
+HEADERS += $${ROOT_DIR}/src/tests/engine/logged_engine.h
+SOURCES += $${ROOT_DIR}/src/tests/engine/logged_engine.cpp
+
+HEADERS += $${ROOT_DIR}/src/tests/engine/suite/*.h
+SOURCES += $${ROOT_DIR}/src/tests/engine/suite/*.cpp
+
+LIBS += -L$${BIN_DIR} -lxivoclient
@@ -0,0 +1,211 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QCoreApplication>
+#include <QDateTime>
+#include <QElapsedTimer>
+#include <QFile>
+#include <QJsonDocument>
+#include <QVariantMap>
+#include <QVector>
+#include <QtAlgorithms>
+
+#ifdef Q_OS_UNIX
+#include <sys/resource.h>
+#endif
+
+#include <baseengine.h>
+
+#include "fake_cti_server.h"
+#include "logged_engine.h"
+#include "cti_replay.h"
+
+static const int EntriesPerQueue = 10;
+
+CTIReplay::CTIReplay(int nb_entities)
+    : m_nb_entities(nb_entities),
+      m_server(NULL),
+      m_engine(NULL),
+      m_bootstrap_ms(0)
+{
+}
+
+CTIReplay::~CTIReplay()
+{
+    delete m_engine;
+    delete m_server;
+}
+
+bool CTIReplay::bootstrap(int timeout)
+{
+    m_server = new FakeCTIServer(m_nb_entities, true);
+    if (! m_server->listen()) {
+        return false;
+    }
+    m_engine = new LoggedEngine(m_server->port());
+
+    QElapsedTimer timer;
+    timer.start();
+    bool initialized = m_engine->login(timeout);
+    m_bootstrap_ms = timer.elapsed();
+
+    return initialized;
+}
+
+/*! \brief a busy call center: status storms with queue entries
+ *
+ * Out of 100 messages, 40 are agent statuses, 25 phone statuses, 20 user
+ * statuses, 10 queue member statuses and 5 queue entry updates.
+ */
+QList<QByteArray> CTIReplay::syntheticSession(int nb_messages) const
+{
+    static const char *availabilities[] = {"available", "unavailable", "on_call_nonacd_incoming_external"};
+    static const char *availstates[] = {"available", "away", "disconnected"};
+    int nb_queues = qMax(1, m_nb_entities / 100);
+
+    QList<QByteArray> messages;
+    for (int i = 0; i < nb_messages; ++i) {
+        int id = i % m_nb_entities + 1;
+        int kind = i % 100;
+        QVariantMap status;
+        if (kind < 40) {
+            status["availability"] = availabilities[i % 3];
+            status["availability_since"] = QDateTime::currentDateTime().toTime_t();
+            messages.append(this->statusMessage("agents", id, status));
+        } else if (kind < 65) {
+            status["hintstatus"] = QString::number(i % 3);
+            messages.append(this->statusMessage("phones", id, status));
+        } else if (kind < 85) {
+            status["availstate"] = availstates[i % 3];
+            messages.append(this->statusMessage("users", id, status));
+        } else if (kind < 95) {
+            status["paused"] = i % 2 ? "1" : "0";
+            status["callstaken"] = QString::number(i);
+            messages.append(this->statusMessage("queuemembers", id, status));
+        } else {
+            messages.append(this->queueEntryMessage(i % nb_queues + 1, i % EntriesPerQueue));
+        }
+    }
+    return messages;
+}
+
+/*! \brief read a recorded session, one json message per line */
+QList<QByteArray> CTIReplay::loadSession(const QString &path)
+{
+    QList<QByteArray> messages;
+    QFile file(path);
+    if (! file.open(QIODevice::ReadOnly)) {
+        return messages;
+    }
+    while (! file.atEnd()) {
+        QByteArray line = file.readLine().trimmed();
+        if (! line.isEmpty()) {
+            messages.append(line);
+        }
+    }
+    return messages;
+}
+
+ReplayResult CTIReplay::replay(const QList<QByteArray> &messages)
+{
+    BaseEngine *engine = m_engine->engine();
+    QVector<qint64> latencies;
+    latencies.reserve(messages.size());
+
+    QElapsedTimer total;
+    QElapsedTimer timer;
+    total.start();
+    foreach (const QByteArray &message, messages) {
+        timer.start();
+        engine->parseCommand(message);
+        latencies.append(timer.nsecsElapsed());
+    }
+    // let the coalesced updates reach their receivers
+    QCoreApplication::processEvents();
+
+    ReplayResult result;
+    result.nb_messages = messages.size();
+    result.elapsed_ns = total.nsecsElapsed();
+    result.p50_ns = 0;
+    result.p99_ns = 0;
+    if (! latencies.isEmpty()) {
+        qSort(latencies);
+        result.p50_ns = latencies[latencies.size() / 2];
+        result.p99_ns = latencies[(latencies.size() - 1) * 99 / 100];
+    }
+    return result;
+}
+
+/*! \return the peak resident set size of the process in kB, 0 if unknown */
+qint64 CTIReplay::peakRss()
+{
+#ifdef Q_OS_UNIX
+    struct rusage usage;
+    if (getrusage(RUSAGE_SELF, &usage) == 0) {
+        return usage.ru_maxrss;
+    }
+#endif
+    return 0;
+}
+
+QByteArray CTIReplay::statusMessage(const QString &listname, int id, const QVariantMap &status) const
+{
+    QVariantMap message;
+    message["class"] = "getlist";
+    message["function"] = "updatestatus";
+    message["listname"] = listname;
+    message["tipbxid"] = "xivo";
+    message["tid"] = QString::number(id);
+    message["status"] = status;
+    message["timenow"] = QDateTime::currentDateTime().toTime_t();
+    return QJsonDocument::fromVariant(message).toJson(QJsonDocument::Compact);
+}
+
+QByteArray CTIReplay::queueEntryMessage(int queue, int nb_entries) const
+{
+    QVariantList entries;
+    for (int i = 0; i < nb_entries; ++i) {
+        QVariantMap entry;
+        entry["position"] = i + 1;
+        entry["name"] = QString("Caller %1").arg(i);
+        entry["number"] = QString::number(5550000 + i);
+        entry["join_time"] = QDateTime::currentDateTime().toTime_t() - i * 10;
+        entry["uniqueid"] = QString("1400000000.%1").arg(i);
+        entries.append(entry);
+    }
+    QVariantMap state;
+    state["queue_id"] = queue;
+    state["entries"] = entries;
+
+    QVariantMap message;
+    message["class"] = "queueentryupdate";
+    message["state"] = state;
+    message["timenow"] = QDateTime::currentDateTime().toTime_t();
+    return QJsonDocument::fromVariant(message).toJson(QJsonDocument::Compact);
+}
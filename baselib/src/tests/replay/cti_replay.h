@@ -0,0 +1,77 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __CTI_REPLAY_H__
+#define __CTI_REPLAY_H__
+
+#include <QByteArray>
+#include <QList>
+
+class FakeCTIServer;
+class LoggedEngine;
+
+struct ReplayResult {
+    int nb_messages;
+    qint64 elapsed_ns;
+    qint64 p50_ns;
+    qint64 p99_ns;
+};
+
+/*! \brief Replays a CTI message stream through a logged in BaseEngine
+ *
+ * The engine logs in to a FakeCTIServer serving nb_entities users, phones
+ * and agents, then each message of the stream is handed to
+ * BaseEngine::parseCommand as if it had been read from the socket.
+ */
+class CTIReplay
+{
+    public:
+        CTIReplay(int nb_entities);
+        ~CTIReplay();
+
+        bool bootstrap(int timeout);
+        qint64 bootstrapTime() const { return m_bootstrap_ms; };
+
+        QList<QByteArray> syntheticSession(int nb_messages) const;
+        static QList<QByteArray> loadSession(const QString &path);
+        ReplayResult replay(const QList<QByteArray> &messages);
+
+        static qint64 peakRss();
+
+    private:
+        QByteArray statusMessage(const QString &listname, int id, const QVariantMap &status) const;
+        QByteArray queueEntryMessage(int queue, int nb_entries) const;
+
+        int m_nb_entities;
+        FakeCTIServer *m_server;
+        LoggedEngine *m_engine;
+        qint64 m_bootstrap_ms;
+};
+
+#endif
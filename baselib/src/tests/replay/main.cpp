@@ -0,0 +1,95 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QCoreApplication>
+#include <QStringList>
+#include <QTextStream>
+
+#include "cti_replay.h"
+
+// Replays a CTI session through BaseEngine at several scales:
+//   export LD_LIBRARY_PATH=../../bin
+//   ./replay [-entities 1000,10000,50000] [-messages 20000] [-session recorded.json]
+// A recorded session holds one json server message per line.
+
+static const int BootstrapTimeout = 600000;
+
+int main (int argc, char *argv[])
+{
+    QCoreApplication app(argc, argv);
+    QStringList args = app.arguments();
+    QTextStream out(stdout);
+
+    QStringList scales = QString("1000,10000,50000").split(",");
+    int nb_messages = 20000;
+    QString session_path;
+    for (int i = 1; i < args.size() - 1; ++i) {
+        if (args[i] == "-entities") {
+            scales = args[++i].split(",");
+        } else if (args[i] == "-messages") {
+            nb_messages = args[++i].toInt();
+        } else if (args[i] == "-session") {
+            session_path = args[++i];
+        }
+    }
+
+    QList<QByteArray> recorded_session;
+    if (! session_path.isEmpty()) {
+        recorded_session = CTIReplay::loadSession(session_path);
+        if (recorded_session.isEmpty()) {
+            out << "could not read any message from " << session_path << endl;
+            return 1;
+        }
+    }
+
+    out << "entities\tinit ms\tmessages\tmsg/s\tp50 us\tp99 us\tpeak RSS kB" << endl;
+    foreach (const QString &scale, scales) {
+        int nb_entities = scale.toInt();
+        CTIReplay replay(nb_entities);
+        if (! replay.bootstrap(BootstrapTimeout)) {
+            out << nb_entities << "\tbootstrap failed" << endl;
+            return 1;
+        }
+
+        QList<QByteArray> session = recorded_session;
+        if (session.isEmpty()) {
+            session = replay.syntheticSession(nb_messages);
+        }
+        ReplayResult result = replay.replay(session);
+
+        out << nb_entities << "\t"
+            << replay.bootstrapTime() << "\t"
+            << result.nb_messages << "\t"
+            << qint64(result.nb_messages * 1e9 / qMax(qint64(1), result.elapsed_ns)) << "\t"
+            << result.p50_ns / 1000.0 << "\t"
+            << result.p99_ns / 1000.0 << "\t"
+            << CTIReplay::peakRss() << endl;
+    }
+    return 0;
+}
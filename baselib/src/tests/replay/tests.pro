@@ -0,0 +1,25 @@
+include (../../../common-tests.pri)
+
+# Replays a CTI session through a BaseEngine and reports its throughput
+
+TARGET = replay
+
+QT += network
+
+SOURCES += $${ROOT_DIR}/src/tests/replay/main.cpp
+
+INCLUDEPATH += $${ROOT_DIR}/src/tests/replay
+INCLUDEPATH += $${ROOT_DIR}/src/tests/engine
+
+INCLUDEPATH += $${ROOT_DIR}/src
+
+HEADERS += $${ROOT_DIR}/src/tests/replay/cti_replay.h
+SOURCES += $${ROOT_DIR}/src/tests/replay/cti_replay.cpp
+
+HEADERS += $${ROOT_DIR}/src/tests/engine/fake_cti_server.h
+SOURCES += $${ROOT_DIR}/src/tests/engine/fake_cti_server.cpp
+
+HEADERS += $${ROOT_DIR}/src/tests/engine/logged_engine.h
+SOURCES += $${ROOT_DIR}/src/tests/engine/logged_engine.cpp
+
+LIBS += -L$${BIN_DIR} -lxivoclient
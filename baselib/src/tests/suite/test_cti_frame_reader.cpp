@@ -0,0 +1,132 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+
+#include <cti_frame_reader.h>
+
+#include "test_cti_frame_reader.h"
+
+void TestCTIFrameReader::testNoFrame()
+{
+    CTIFrameReader reader;
+    QByteArray frame;
+
+    reader.append("{\"class\": \"getlist\"");
+
+    QVERIFY(! reader.nextFrame(&frame));
+    QCOMPARE(reader.pendingSize(), 19);
+}
+
+void TestCTIFrameReader::testSeveralFrames()
+{
+    CTIFrameReader reader;
+    QByteArray frame;
+
+    reader.append("{\"a\": 1}\n{\"b\": 2}\n{\"c\"");
+
+    QVERIFY(reader.nextFrame(&frame));
+    QCOMPARE(frame, QByteArray("{\"a\": 1}"));
+    QVERIFY(reader.nextFrame(&frame));
+    QCOMPARE(frame, QByteArray("{\"b\": 2}"));
+    QVERIFY(! reader.nextFrame(&frame));
+    QCOMPARE(reader.pendingSize(), 4);
+}
+
+void TestCTIFrameReader::testFrameSplitAcrossReads()
+{
+    CTIFrameReader reader;
+    QByteArray frame;
+
+    reader.append("{\"class\": ");
+    QVERIFY(! reader.nextFrame(&frame));
+    reader.append("\"getlist\"}");
+    QVERIFY(! reader.nextFrame(&frame));
+    reader.append("\n{");
+
+    QVERIFY(reader.nextFrame(&frame));
+    QCOMPARE(frame, QByteArray("{\"class\": \"getlist\"}"));
+    QVERIFY(! reader.nextFrame(&frame));
+    QCOMPARE(reader.pendingSize(), 1);
+}
+
+void TestCTIFrameReader::testEmptyFrame()
+{
+    CTIFrameReader reader;
+    QByteArray frame("not empty");
+
+    reader.append("\n");
+
+    QVERIFY(reader.nextFrame(&frame));
+    QVERIFY(frame.isEmpty());
+    QCOMPARE(reader.pendingSize(), 0);
+}
+
+void TestCTIFrameReader::testClear()
+{
+    CTIFrameReader reader;
+    QByteArray frame;
+
+    reader.append("{\"a\": 1}\n{\"b\"");
+    reader.clear();
+    reader.append("{\"c\": 3}\n");
+
+    QVERIFY(reader.nextFrame(&frame));
+    QCOMPARE(frame, QByteArray("{\"c\": 3}"));
+}
+
+void TestCTIFrameReader::testIsUiForm()
+{
+    QVERIFY(CTIFrameReader::isUiForm("<ui version=\"4.0\"><widget/></ui>"));
+    QVERIFY(! CTIFrameReader::isUiForm("{\"class\": \"sheet\"}"));
+}
+
+void TestCTIFrameReader::benchmarkFraming()
+{
+    QByteArray message("{\"class\": \"getlist\", \"function\": \"updatestatus\", \"listname\": \"agents\", "
+                       "\"tipbxid\": \"xivo\", \"tid\": \"12\", \"status\": {\"availability\": \"available\"}}\n");
+    QByteArray session;
+    for (int i = 0; i < 1000; ++i) {
+        session.append(message);
+    }
+
+    QBENCHMARK {
+        CTIFrameReader reader;
+        QByteArray frame;
+        int frame_count = 0;
+        // the socket hands data out in chunks that do not match messages
+        for (int offset = 0; offset < session.size(); offset += 1460) {
+            reader.append(session.mid(offset, 1460));
+            while (reader.nextFrame(&frame)) {
+                ++frame_count;
+            }
+        }
+        QCOMPARE(frame_count, 1000);
+    }
+}
@@ -286,3 +286,35 @@ void TestMessageFactory::testRegisterUserStatus()
 
     QCOMPARE(result, expected);
 }
+
+void TestMessageFactory::testGetlistUpdateConfig()
+{
+    QStringList ids = QStringList() << "1" << "2" << "42";
+
+    QVariantMap result = MessageFactory::getlistUpdateConfig("agents", "xivo", ids);
+
+    QVariantMap expected;
+    expected["class"] = "getlist";
+    expected["function"] = "updateconfig";
+    expected["listname"] = "agents";
+    expected["tipbxid"] = "xivo";
+    expected["tids"] = ids;
+
+    QCOMPARE(result, expected);
+}
+
+void TestMessageFactory::testGetlistUpdateStatus()
+{
+    QStringList ids = QStringList() << "1" << "2" << "42";
+
+    QVariantMap result = MessageFactory::getlistUpdateStatus("queuemembers", "xivo", ids);
+
+    QVariantMap expected;
+    expected["class"] = "getlist";
+    expected["function"] = "updatestatus";
+    expected["listname"] = "queuemembers";
+    expected["tipbxid"] = "xivo";
+    expected["tids"] = ids;
+
+    QCOMPARE(result, expected);
+}
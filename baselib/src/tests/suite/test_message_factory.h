@@ -57,6 +57,8 @@ class TestMessageFactory: public QObject
         void testRegisterAgentStatus();
         void testRegisterEndpointStatus();
         void testRegisterUserStatus();
+        void testGetlistUpdateConfig();
+        void testGetlistUpdateStatus();
 };
 
 #endif /* __TEST_MESSAGE_FACTORY_H__ */
@@ -29,6 +29,7 @@
 
 #include <QtTest/QtTest>
 
+#include <test_cti_frame_reader.h>
 #include <test_id_converter.h>
 #include <test_message_factory.h>
 
@@ -38,9 +39,11 @@
 
 int main (int argc, char *argv[])
 {
+    TestCTIFrameReader test_cti_frame_reader;
     TestIdConverter test_id_converter;
     TestMessageFactory test_message_factory;
 
+    QTest::qExec(&test_cti_frame_reader, argc, argv);
     QTest::qExec(&test_id_converter, argc, argv);
     QTest::qExec(&test_message_factory, argc, argv);
 
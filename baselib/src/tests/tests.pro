@@ -12,6 +12,9 @@ INCLUDEPATH += $${ROOT_DIR}/src
 HEADERS += $${ROOT_DIR}/src/tests/suite/*.h
 SOURCES += $${ROOT_DIR}/src/tests/suite/*.cpp
 
+HEADERS += $${ROOT_DIR}/src/cti_frame_reader.h
+SOURCES += $${ROOT_DIR}/src/cti_frame_reader.cpp
+
 HEADERS += $${ROOT_DIR}/src/id_converter.h
 SOURCES += $${ROOT_DIR}/src/id_converter.cpp
 
@@ -0,0 +1,179 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QDebug>
+
+#include "update_router.h"
+
+UpdateRouter::UpdateRouter(QObject *parent)
+    : QObject(parent)
+{
+}
+
+/*! \brief invoke member of receiver for the updates of xid in listname
+ *
+ * member is given with the SLOT() macro, as for QObject::connect.
+ * Subscribing twice to the same xid has no effect.
+ */
+bool UpdateRouter::subscribe(const QString &listname, Update update, const QString &xid,
+                             QObject *receiver, const char *member)
+{
+    if (receiver == NULL || member == NULL || xid.isEmpty()) {
+        return false;
+    }
+
+    // skip the code added by the SLOT() macro
+    QByteArray signature = QMetaObject::normalizedSignature(member + 1);
+    int index = receiver->metaObject()->indexOfMethod(signature.constData());
+    if (index == -1) {
+        qDebug() << Q_FUNC_INFO << "no such slot" << signature << "in" << receiver;
+        return false;
+    }
+
+    QList<Subscriber> &subscribers = m_subscribers[Key(listname, update)][xid];
+    foreach (const Subscriber &subscriber, subscribers) {
+        if (subscriber.receiver == receiver) {
+            return true;
+        }
+    }
+
+    Subscriber subscriber;
+    subscriber.receiver = receiver;
+    subscriber.guard = receiver;
+    subscriber.method = receiver->metaObject()->method(index);
+    subscribers.append(subscriber);
+
+    if (m_subscription_count[receiver]++ == 0) {
+        connect(receiver, SIGNAL(destroyed(QObject *)),
+                this, SLOT(receiverDestroyed(QObject *)));
+    }
+    return true;
+}
+
+void UpdateRouter::unsubscribe(const QString &listname, Update update, const QString &xid,
+                               QObject *receiver)
+{
+    QHash<Key, SubscribersByXid>::iterator list = m_subscribers.find(Key(listname, update));
+    if (list == m_subscribers.end()) {
+        return;
+    }
+    SubscribersByXid::iterator subscribers = list->find(xid);
+    if (subscribers == list->end()) {
+        return;
+    }
+
+    for (int i = 0; i < subscribers->size(); ++i) {
+        if (subscribers->at(i).receiver == receiver) {
+            subscribers->removeAt(i);
+            if (--m_subscription_count[receiver] == 0) {
+                m_subscription_count.remove(receiver);
+                disconnect(receiver, SIGNAL(destroyed(QObject *)),
+                           this, SLOT(receiverDestroyed(QObject *)));
+            }
+            break;
+        }
+    }
+    if (subscribers->isEmpty()) {
+        list->erase(subscribers);
+    }
+}
+
+//! remove all the subscriptions of receiver
+void UpdateRouter::unsubscribe(QObject *receiver)
+{
+    this->forget(receiver, true);
+}
+
+int UpdateRouter::subscriberCount(const QString &listname, Update update, const QString &xid) const
+{
+    return m_subscribers.value(Key(listname, update)).value(xid).size();
+}
+
+void UpdateRouter::route(const QString &listname, Update update, const QString &xid,
+                         const QVariantMap &data) const
+{
+    QHash<Key, SubscribersByXid>::const_iterator list = m_subscribers.constFind(Key(listname, update));
+    if (list == m_subscribers.constEnd()) {
+        return;
+    }
+    SubscribersByXid::const_iterator found = list->constFind(xid);
+    if (found == list->constEnd()) {
+        return;
+    }
+
+    // slots may subscribe or unsubscribe, invoke a copy of the list
+    QList<Subscriber> subscribers = found.value();
+    foreach (const Subscriber &subscriber, subscribers) {
+        if (subscriber.guard.isNull()) {
+            continue;
+        }
+        if (subscriber.method.parameterCount() > 1) {
+            subscriber.method.invoke(subscriber.receiver, Qt::DirectConnection,
+                                     Q_ARG(QString, xid), Q_ARG(QVariantMap, data));
+        } else {
+            subscriber.method.invoke(subscriber.receiver, Qt::DirectConnection,
+                                     Q_ARG(QString, xid));
+        }
+    }
+}
+
+void UpdateRouter::receiverDestroyed(QObject *receiver)
+{
+    this->forget(receiver, false);
+}
+
+void UpdateRouter::forget(QObject *receiver, bool disconnect_receiver)
+{
+    if (! m_subscription_count.contains(receiver)) {
+        return;
+    }
+
+    QHash<Key, SubscribersByXid>::iterator list;
+    for (list = m_subscribers.begin(); list != m_subscribers.end(); ++list) {
+        SubscribersByXid::iterator subscribers = list->begin();
+        while (subscribers != list->end()) {
+            for (int i = subscribers->size() - 1; i >= 0; --i) {
+                if (subscribers->at(i).receiver == receiver) {
+                    subscribers->removeAt(i);
+                }
+            }
+            if (subscribers->isEmpty()) {
+                subscribers = list->erase(subscribers);
+            } else {
+                ++subscribers;
+            }
+        }
+    }
+
+    m_subscription_count.remove(receiver);
+    if (disconnect_receiver) {
+        disconnect(receiver, SIGNAL(destroyed(QObject *)),
+                   this, SLOT(receiverDestroyed(QObject *)));
+    }
+}
@@ -0,0 +1,94 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __UPDATE_ROUTER_H__
+#define __UPDATE_ROUTER_H__
+
+#include <QHash>
+#include <QList>
+#include <QMetaMethod>
+#include <QObject>
+#include <QPair>
+#include <QPointer>
+#include <QString>
+#include <QVariantMap>
+
+#include "baselib_export.h"
+
+/*! \brief Delivers the updates of a few xids to the objects watching them
+ *
+ * The update signals of BaseEngine reach every connected slot, which is
+ * right for the models showing a whole list but wasteful for the xlets
+ * following one user, phone or agent. Those subscribe to their xids here
+ * and their slot is only invoked for these xids.
+ *
+ * The slot takes the xid, optionally followed by the QVariantMap of the
+ * config or the status carried by the message. Subscriptions are dropped when the receiver is destroyed.
+ */
+class BASELIB_EXPORT UpdateRouter : public QObject
+{
+    Q_OBJECT
+
+    public:
+        enum Update {
+            CONFIG,
+            STATUS
+        };
+
+        UpdateRouter(QObject *parent=NULL);
+
+        bool subscribe(const QString &listname, Update update, const QString &xid,
+                       QObject *receiver, const char *member);
+        void unsubscribe(const QString &listname, Update update, const QString &xid,
+                         QObject *receiver);
+        void unsubscribe(QObject *receiver);
+        int subscriberCount(const QString &listname, Update update, const QString &xid) const;
+
+        void route(const QString &listname, Update update, const QString &xid,
+                   const QVariantMap &data=QVariantMap()) const;
+
+    private slots:
+        void receiverDestroyed(QObject *receiver);
+
+    private:
+        struct Subscriber {
+            QObject *receiver;
+            QPointer<QObject> guard;    //!< null once an earlier slot deleted the receiver
+            QMetaMethod method;
+        };
+        typedef QHash<QString, QList<Subscriber> > SubscribersByXid;
+        typedef QPair<QString, int> Key;    //!< listname and update
+
+        void forget(QObject *receiver, bool disconnect_receiver);
+
+        QHash<Key, SubscribersByXid> m_subscribers;      //!< (listname, update) -> xid -> subscribers
+        QHash<QObject *, int> m_subscription_count;      //!< receiver -> number of subscriptions
+};
+
+#endif
@@ -3,3 +3,5 @@ TEMPLATE = subdirs
 SUBDIRS  = \
     src/tests/ \
     src/storage/tests/ \
+    src/tests/engine/ \
+    src/tests/replay/ \
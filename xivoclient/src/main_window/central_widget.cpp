@@ -49,6 +49,7 @@ CentralWidget::CentralWidget(MainWindow *parent)
     this->connect(b_engine, SIGNAL(delogged()), SLOT(setStatusNotLogged()));
     this->connect(b_engine, SIGNAL(initializing()), SLOT(initializing()));
     this->connect(b_engine, SIGNAL(initialized()), SLOT(initialized()));
+    this->connect(b_engine, SIGNAL(initializationProgress(int, int)), SLOT(initializationProgress(int, int)));
     this->connect(parent, SIGNAL(initialized()), SLOT(initialize()));
 }
 
@@ -83,6 +84,14 @@ void CentralWidget::initialized()
     this->m_main_window->prepareState();
 }
 
+void CentralWidget::initializationProgress(int seen, int total)
+{
+    if (! this->m_loading_dialog || total == 0) {
+        return;
+    }
+    this->ui_loading_dialog->label->setText(tr("Loading... %1%").arg(100 * seen / total));
+}
+
 void CentralWidget::setStatusLogged()
 {
     chit_chat = new ChitChatDispatcher(this);
@@ -120,6 +129,8 @@ void CentralWidget::showLoading()
         exit(EXIT_FAILURE);
     }
     this->ui_loading_dialog->setupUi(this->m_loading_dialog);
+    QLabel *label = this->ui_loading_dialog->label;
+    label->setMinimumWidth(label->fontMetrics().width(tr("Loading... %1%").arg(100)));
     this->m_loading_dialog->adjustSize();
     this->m_loading_dialog->setFixedSize(this->m_loading_dialog->width(),this->m_loading_dialog->height());
     this->m_loading_dialog->show();
@@ -129,4 +140,5 @@ void CentralWidget::hideLoading()
 {
     this->m_loading_dialog->hide();
     this->m_loading_dialog->deleteLater();
+    this->m_loading_dialog = NULL;
 }
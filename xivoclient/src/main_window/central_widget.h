@@ -51,6 +51,7 @@ class CentralWidget : public QStackedWidget
         void initialize();
         void initializing();
         void initialized();
+        void initializationProgress(int seen, int total);
         void setStatusNotLogged();
         void setStatusLogged();
 
@@ -42,7 +42,6 @@ MenuAvailability::MenuAvailability(const QString &title, QWidget *parent)
     this->m_availability_action_group->setExclusive(true);
 
     this->connect(b_engine, SIGNAL(localUserInfoDefined()), SLOT(updatePresence()));
-    this->connect(b_engine, SIGNAL(updateUserStatus(const QString &)), SLOT(updateUserStatus(const QString &)));
     this->connect(b_engine, SIGNAL(logged()), SLOT(setStatusLogged()));
     this->connect(b_engine, SIGNAL(delogged()), SLOT(setStatusNotLogged()));
     this->connect(b_engine, SIGNAL(settingsChanged()), SLOT(confUpdated()));
@@ -59,6 +58,7 @@ void MenuAvailability::setStatusLogged()
 
 void MenuAvailability::setStatusNotLogged()
 {
+    b_engine->updateRouter().unsubscribe(this);
     this->setMenuAvailabilityEnabled(false);
     this->clearPresence();
 }
@@ -73,6 +73,9 @@ void MenuAvailability::confUpdated()
  */
 void MenuAvailability::updatePresence()
 {
+    b_engine->updateRouter().subscribe("users", UpdateRouter::STATUS, b_engine->getFullId(),
+                                       this, SLOT(updateUserStatus(const QString &)));
+
     const QVariantMap & presencemap = b_engine->getOptionsUserStatus();
 
     foreach (const QString & presencestate, presencemap.keys()) {
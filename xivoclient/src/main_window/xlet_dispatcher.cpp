@@ -28,6 +28,7 @@
  */
 
 #include <QMap>
+#include <QSettings>
 
 #include <baseengine.h>
 #include <xletfactory.h>
@@ -50,6 +51,7 @@ XletDispatcher::XletDispatcher(MainWindow *main_window, MainWidget *main_widget,
       m_xlets_grid(),
       m_xlets_tab_widget(),
       m_xlets_tab(),
+      m_replacing_tab(false),
       m_tabber(NULL),
       m_fold_signal_mapper(new QSignalMapper(this)),
       m_unfold_signal_mapper(new QSignalMapper(this))
@@ -109,6 +111,12 @@ XletDispatcher::~XletDispatcher()
 {
 }
 
+/*! \brief spawn the visible xlets only
+ *
+ * Xlets in other tabs or in hidden docks get a placeholder and are
+ * spawned when they are first shown. The placeholder shows the tab icon
+ * and title given by the xlet plugin.
+ */
 void XletDispatcher::setStatusLogged()
 {
     this->prepareAppearance();
@@ -150,6 +158,37 @@ XLet *XletDispatcher::xletFactory(const QString &xlet_id)
     return xlet;
 }
 
+void XletDispatcher::spawnPendingXlet(const QString &xlet_name)
+{
+    if (this->m_xlets_tab_placeholder.contains(xlet_name)) {
+        this->spawnTabXlet(xlet_name);
+    } else if (this->m_xlets_dock_widget.contains(xlet_name)
+               && this->m_xlets_dock_widget.value(xlet_name)->widget() == NULL) {
+        this->spawnDockXlet(xlet_name);
+    }
+}
+
+void XletDispatcher::tabShown(int index)
+{
+    if (this->m_replacing_tab || ! this->m_tabber) {
+        return;
+    }
+
+    QWidget *widget = this->m_tabber->tabWidget()->widget(index);
+    const QString &xlet_name = this->m_xlets_tab_placeholder.key(widget);
+    if (! xlet_name.isEmpty()) {
+        this->spawnPendingXlet(xlet_name);
+    }
+}
+
+void XletDispatcher::dockVisibilityChanged(bool visible)
+{
+    QDockWidget *dock_widget = qobject_cast<QDockWidget *>(this->sender());
+    if (visible && dock_widget) {
+        this->spawnPendingXlet(dock_widget->objectName());
+    }
+}
+
 void XletDispatcher::prepareXletsGrid()
 {
     if (!this->hasWidget()) {
@@ -199,6 +238,10 @@ void XletDispatcher::cleanXletsGrid()
     this->m_xlets_grid_widget.clear();
 }
 
+/*! \brief add a placeholder tab for each xlet and spawn the current one
+ *
+ * The last focused tab is restored, clamped to the existing tabs.
+ */
 void XletDispatcher::prepareXletsTab()
 {
     if (! this->m_tabber) {
@@ -206,19 +249,52 @@ void XletDispatcher::prepareXletsTab()
     }
 
     QTabWidget *tab_widget = this->m_tabber->tabWidget();
+    connect(tab_widget, SIGNAL(currentChanged(int)),
+            this, SLOT(tabShown(int)));
 
+    this->m_replacing_tab = true;
     foreach (const XletAndOption &xlet_and_option, this->m_xlets_tab) {
         const QString &name = xlet_and_option.first;
-        XLet *xlet = this->xletFactory(name);
-        if (xlet) {
-            int tabIndex = tab_widget->addTab(xlet, QIcon(xlet->iconPath()), "");
-            tab_widget->setTabToolTip(tabIndex, xlet->title());
-            this->m_xlets_tab_widget.insert(name, xlet);
+        QString title, icon_path;
+        XLetFactory::look(name, &title, &icon_path);
+        QWidget *placeholder = new QWidget(this->m_main_widget);
+        int tabIndex = tab_widget->addTab(placeholder, QIcon(icon_path), "");
+        tab_widget->setTabToolTip(tabIndex, title);
+        this->m_xlets_tab_placeholder.insert(name, placeholder);
+    }
+
+    int last_index = b_engine->getSettings()->value("display/lastfocusedtab").toInt();
+    tab_widget->setCurrentIndex(qBound(0, last_index, tab_widget->count() - 1));
+    this->m_replacing_tab = false;
+
+    this->tabShown(tab_widget->currentIndex());
+}
+
+void XletDispatcher::spawnTabXlet(const QString &xlet_name)
+{
+    QWidget *placeholder = this->m_xlets_tab_placeholder.take(xlet_name);
+    QTabWidget *tab_widget = this->m_tabber->tabWidget();
+    int index = tab_widget->indexOf(placeholder);
+    bool is_current = (tab_widget->currentIndex() == index);
+
+    XLet *xlet = this->xletFactory(xlet_name);
+
+    this->m_replacing_tab = true;
+    tab_widget->removeTab(index);
+    if (xlet) {
+        tab_widget->insertTab(index, xlet, QIcon(xlet->iconPath()), "");
+        tab_widget->setTabToolTip(index, xlet->title());
+        this->m_xlets_tab_widget.insert(xlet_name, xlet);
+        if (is_current) {
+            tab_widget->setCurrentIndex(index);
         }
     }
+    this->m_replacing_tab = false;
+    placeholder->deleteLater();
 
-    int new_index = b_engine->getSettings()->value("display/lastfocusedtab").toInt();
-    tab_widget->setCurrentIndex(new_index);
+    if (is_current && ! xlet) {
+        this->tabShown(tab_widget->currentIndex());
+    }
 }
 
 void XletDispatcher::cleanXletsTab()
@@ -236,6 +312,10 @@ void XletDispatcher::cleanXletsTab()
         widget->deleteLater();
     }
     this->m_xlets_tab_widget.clear();
+    foreach (QWidget *widget, this->m_xlets_tab_placeholder.values()) {
+        widget->deleteLater();
+    }
+    this->m_xlets_tab_placeholder.clear();
 
     this->m_tabber->deleteLater();
     this->m_tabber = NULL;
@@ -251,28 +331,48 @@ void XletDispatcher::prepareXletsDock()
         const QString &name = xlet_and_option.first;
         const QString &options = xlet_and_option.second;
 
-        XLet *xlet = this->xletFactory(name);
-        if (! xlet) {
-            qDebug() << Q_FUNC_INFO << "Failed to instanciate xlet" << name;
-            continue;
-        }
-
+        QString title, icon_path;
+        XLetFactory::look(name, &title, &icon_path);
         QDockWidget::DockWidgetFeatures features = this->getXletsDockFeatures(options);
-        QDockWidget *dockWidget = new QDockWidget(xlet->title(), this->m_main_widget);
+        QDockWidget *dockWidget = new QDockWidget(title, this->m_main_widget);
         dockWidget->setFeatures(features);
         dockWidget->setAllowedAreas(Qt::BottomDockWidgetArea);
         dockWidget->setObjectName(name);
-        if (options.contains("s")) { // with scrollbar ?
-            QScrollArea *dockWidgetContents = new QScrollArea(this->m_main_widget);
-            dockWidgetContents->setWidget(xlet);
-            dockWidgetContents->setWidgetResizable(true);
-            dockWidget->setWidget(dockWidgetContents);
-        } else {
-            dockWidget->setWidget(xlet);
-        }
         this->m_main_window->addDockWidget(Qt::BottomDockWidgetArea, dockWidget);
         this->m_xlets_dock_widget.insert(name, dockWidget);
         dockWidget->hide();
+        connect(dockWidget, SIGNAL(visibilityChanged(bool)),
+                this, SLOT(dockVisibilityChanged(bool)));
+    }
+}
+
+void XletDispatcher::spawnDockXlet(const QString &xlet_name)
+{
+    QDockWidget *dockWidget = this->m_xlets_dock_widget.value(xlet_name);
+    XLet *xlet = this->xletFactory(xlet_name);
+    if (! xlet) {
+        qDebug() << Q_FUNC_INFO << "Failed to instanciate xlet" << xlet_name;
+        this->m_main_window->removeDockWidget(dockWidget);
+        this->m_xlets_dock_widget.remove(xlet_name);
+        dockWidget->deleteLater();
+        return;
+    }
+
+    QString options;
+    foreach (const XletAndOption &xlet_and_option, this->m_xlets_dock) {
+        if (xlet_and_option.first == xlet_name) {
+            options = xlet_and_option.second;
+        }
+    }
+
+    dockWidget->setWindowTitle(xlet->title());
+    if (options.contains("s")) { // with scrollbar ?
+        QScrollArea *dockWidgetContents = new QScrollArea(this->m_main_widget);
+        dockWidgetContents->setWidget(xlet);
+        dockWidgetContents->setWidgetResizable(true);
+        dockWidget->setWidget(dockWidgetContents);
+    } else {
+        dockWidget->setWidget(xlet);
     }
 }
 
@@ -65,6 +65,8 @@ class XletDispatcher : public QObject
         void showWidgetOnTop(QWidget *);
         void showOneXlet(const QString &xlet_name);
         void showAllXlets();
+        void tabShown(int index);
+        void dockVisibilityChanged(bool visible);
 
     private:
         typedef QPair<QString, QString> XletAndOption;
@@ -79,6 +81,9 @@ class XletDispatcher : public QObject
         QDockWidget::DockWidgetFeatures getXletsDockFeatures(const QString &options);
         void cleanXletsDock();
         XLet *xletFactory(const QString &xlet_id);
+        void spawnPendingXlet(const QString &xlet_name);
+        void spawnTabXlet(const QString &xlet_name);
+        void spawnDockXlet(const QString &xlet_name);
         void restoreMainWindow();
 
         MainWindow *m_main_window;
@@ -96,6 +101,8 @@ class XletDispatcher : public QObject
 
         QMap<QString, XLet *> m_xlets_tab_widget;
         QList<XletAndOption> m_xlets_tab;
+        QMap<QString, QWidget *> m_xlets_tab_placeholder;   //!< tabs of the xlets not spawned yet
+        bool m_replacing_tab;   //!< tabs are being added or replaced, tabShown must not spawn
 
         Tabber *m_tabber;
 
@@ -29,6 +29,7 @@
 
 #include <QDebug>
 #include <QApplication>
+#include <QCoreApplication>
 #include <QPluginLoader>
 #include <QDir>
 #include <QHash>
@@ -52,8 +53,10 @@ typedef XLet* (*newXLetProto)(QWidget *);
 static const struct {
     const char *name;
     const newXLetProto construct;
+    const char *context;
+    const char *title;
 } xlets[] = {
-    { "customerinfo"      ,newXLet<CustomerInfoPanel>      },
+    { "customerinfo"      ,newXLet<CustomerInfoPanel>      ,QT_TRANSLATE_NOOP("CustomerInfoPanel", "Sheets") },
 };
 
 /*! xlet creator function prototype */
@@ -106,16 +109,46 @@ static bool findPluginDir()
     return pluginDirFound;
 }
 
-/*! \brief build a new XLet depending on the type wanted
+/*! \brief load the plugin of an XLet
  *
- *  First try to find the XLet into the built-in list, then
- *  search for a plugin.
  *  Plugin name is lib<id>plugin.so under Linux, <id>plugin.dll under
  *  Win32, and lib<id>plugin.dylib under Mac Os X.
  *
- *  \return a pointer to the XLet or NULL if it was not found
+ *  \return the plugin interface or NULL if it could not be loaded
  */
+static XLetInterface *loadPlugin(const QString &id)
+{
+    QString fileName = "lib" + id + "plugin.so";
+#ifdef Q_OS_WIN
+    fileName = id + "plugin.dll";
+#endif
+#ifdef Q_OS_MAC
+    fileName = "lib" + id + "plugin.dylib";
+#endif
+
+    QPluginLoader loader(pluginDir.absoluteFilePath(fileName));
+    QObject *plugin = loader.instance();
+
+    if (! plugin) {
+        qDebug() << Q_FUNC_INFO << "failed to load plugin :"<< loader.errorString();
+        return NULL;
+    }
+
+    XLetInterface *xleti = qobject_cast<XLetInterface *>(plugin);
+    if (! xleti) {
+        qDebug() << Q_FUNC_INFO << "failed to cast plugin loaded to XLetInterface";
+    }
+    return xleti;
+}
+
 namespace XLetFactory {
+    /*! \brief build a new XLet depending on the type wanted
+     *
+     *  First try to find the XLet into the built-in list, then
+     *  search for a plugin.
+     *
+     *  \return a pointer to the XLet or NULL if it was not found
+     */
     XLet* spawn(const QString &id, QWidget *parent)
     {
         if (initied == false) {
@@ -123,36 +156,53 @@ namespace XLetFactory {
             findPluginDir();
         }
 
-        XLet *xlet = NULL;
-
         newXLetProto construct = xletList.value(id);
-
         if (construct) {
-            xlet = construct(parent);
-        } else {
-	    QString fileName = "lib" + id + "plugin.so";
-#ifdef Q_OS_WIN
-            fileName = id + "plugin.dll";
-#endif
-#ifdef Q_OS_MAC
-            fileName = "lib" + id + "plugin.dylib";
-#endif
+            return construct(parent);
+        }
+
+        XLetInterface *xleti = loadPlugin(id);
+        if (xleti) {
+            return xleti->newXLetInstance(parent);
+        }
+        return NULL;
+    }
+
+    /*! \brief title and tab icon of an XLet, without spawning it
+     *
+     *  Both fall back to the defaults when the XLet does not provide them:
+     *  the id for the title and the bang icon for the tab.
+     */
+    void look(const QString &id, QString *title, QString *icon_path)
+    {
+        if (initied == false) {
+            init();
+            findPluginDir();
+        }
 
-            QPluginLoader loader(pluginDir.absoluteFilePath(fileName));
-            QObject *plugin = loader.instance();
+        *title = QString();
+        *icon_path = QString();
 
-            if (plugin) {
-                XLetInterface *xleti = qobject_cast<XLetInterface *>(plugin);
-                if (xleti) {
-                    xlet = xleti->newXLetInstance(parent);
-                } else {
-                    qDebug() << Q_FUNC_INFO << "failed to cast plugin loaded to XLetInterface";
+        if (xletList.contains(id)) {
+            int i;
+            for (i=0;i<nelem(xlets);i++) {
+                if (id == xlets[i].name) {
+                    *title = QCoreApplication::translate(xlets[i].context, xlets[i].title);
                 }
-            } else {
-                qDebug() << Q_FUNC_INFO << "failed to load plugin :"<< loader.errorString();
+            }
+        } else {
+            XLetInterface *xleti = loadPlugin(id);
+            if (xleti) {
+                *title = xleti->xletTitle();
+                *icon_path = xleti->xletIconPath();
             }
         }
 
-        return xlet;
+        if (title->isEmpty()) {
+            *title = id;
+        }
+        if (icon_path->isEmpty()) {
+            *icon_path = ":/images/tab-bang.svg";
+        }
     }
 }
@@ -36,10 +36,12 @@
 
 /*! \brief XLet Factory
  *
- * Use spawn to instanciate an XLet.
+ * Use spawn to instanciate an XLet, and look to get its title and tab
+ * icon without instanciating it.
  * XLet are spawned from a built in xlet list, or if this fail from a plugin */
 namespace XLetFactory {
     XLet* spawn(const QString &id, QWidget *parent);
+    void look(const QString &id, QString *title, QString *icon_path);
 }
 
 #endif
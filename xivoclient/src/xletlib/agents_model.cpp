@@ -28,6 +28,7 @@
  */
 
 #include <QBrush>
+#include <QtAlgorithms>
 
 #include <baseengine.h>
 #include <dao/queuememberdao.h>
@@ -50,14 +51,20 @@ AgentsModel::AgentsModel(QObject *parent)
     m_headers[PAUSED_STATUS] = tr("Paused");
     m_headers[PAUSED_QUEUES] = tr("Paused\nqueues");
 
-    connect(b_engine, SIGNAL(updateAgentConfig(const QString &)),
+    connect(b_engine, SIGNAL(updateAgentConfig(const QString &, quint32)),
             this, SLOT(updateAgentConfig(const QString &)));
     connect(b_engine, SIGNAL(removeAgentConfig(const QString &)),
             this, SLOT(removeAgentConfig(const QString &)));
-    connect(b_engine, SIGNAL(updateAgentStatus(const QString &)),
-            this, SLOT(updateAgentStatus(const QString &)));
+    connect(b_engine, SIGNAL(updateAgentStatuses(const QSet<QString> &, quint32)),
+            this, SLOT(updateAgentStatuses(const QSet<QString> &, quint32)));
     connect(b_engine, SIGNAL(statusListen(const QString &, const QString &, const QString &)),
             this, SLOT(updateAgentListenStatus(const QString &, const QString &, const QString &)));
+
+    // agents received before the model was created
+    foreach (const AgentInfo *agent, b_engine->agents()) {
+        m_id2row[agent->xid()] = m_row2id.size();
+        m_row2id.append(agent->xid());
+    }
 }
 
 int AgentsModel::rowCount(const QModelIndex&) const
@@ -77,19 +84,33 @@ bool AgentsModel::removeRows(int row, int count, const QModelIndex & index)
         beginRemoveRows(index, row, row + count - 1);
         for (int i = 0 ; i < count ; i ++) {
             ret = ret && row < m_row2id.size();
-            m_row2id.removeAt(row);
+            if (row < m_row2id.size()) {
+                QString agent_id = m_row2id.takeAt(row);
+                m_id2row.remove(agent_id);
+                m_displayed_availability.remove(agent_id);
+            }
+        }
+        // following rows moved up
+        for (int i = row ; i < m_row2id.size() ; i ++) {
+            m_id2row[m_row2id[i]] = i;
         }
         endRemoveRows();
     }
     return ret;
 }
 
+int AgentsModel::rowOf(const QString &agent_id) const
+{
+    return m_id2row.value(agent_id, -1);
+}
+
 void AgentsModel::updateAgentConfig(const QString &agent_id)
 {
-    if (! m_row2id.contains(agent_id)) {
+    if (this->rowOf(agent_id) == -1) {
         int insertedRow = m_row2id.size();
         beginInsertRows(QModelIndex(), insertedRow, insertedRow);
         m_row2id.append(agent_id);
+        m_id2row[agent_id] = insertedRow;
         endInsertRows();
 
     } else {
@@ -99,29 +120,49 @@ void AgentsModel::updateAgentConfig(const QString &agent_id)
 
 void AgentsModel::removeAgentConfig(const QString &agent_id)
 {
-    if (m_row2id.contains(agent_id)) {
-        int removedRow = m_row2id.indexOf(agent_id);
+    int removedRow = this->rowOf(agent_id);
+    if (removedRow != -1) {
         removeRow(removedRow);
     }
 }
 
-void AgentsModel::updateAgentStatus(const QString &agent_id)
+/*! \brief refresh the columns showing the fields changed in the agents
+ *
+ * The status of an agent only carries its availability and its queues, the
+ * name and number columns are refreshed by updateAgentConfig. The queue
+ * columns are always refreshed: the paused status comes from the queue
+ * members, which are not part of the agent change mask.
+ */
+void AgentsModel::updateAgentStatuses(const QSet<QString> &agent_ids, quint32 fields)
 {
-    if (!m_row2id.contains(agent_id)) {
-        return;
+    int first_column = JOINED_QUEUES;
+    int last_column = PAUSED_QUEUES;
+    if (fields & (AgentInfo::FIELD_AVAILABILITY | AgentInfo::FIELD_AVAILABILITY_SINCE)) {
+        first_column = qMin(first_column, int(AVAILABILITY));
+    }
+    if (fields & ~(AgentInfo::FIELD_AVAILABILITY | AgentInfo::FIELD_AVAILABILITY_SINCE | AgentInfo::FIELD_QUEUES)) {
+        first_column = 0;
+        last_column = NB_COL - 1;
     }
 
-    const AgentInfo * agentinfo = b_engine->agent(agent_id);
-    if (agentinfo == NULL) return;
-
-    this->refreshAgentRow(agent_id);
+    QList<int> rows;
+    foreach (const QString &agent_id, agent_ids) {
+        int row = this->rowOf(agent_id);
+        if (row != -1) {
+            rows.append(row);
+        }
+    }
+    this->refreshRows(rows, first_column, last_column);
 }
 
 void AgentsModel::refreshAgentRow(const QString & agent_id)
 {
+    int agent_row_id = this->rowOf(agent_id);
+    if (agent_row_id == -1) {
+        return;
+    }
     unsigned first_column_index = 0;
     unsigned last_column_index = NB_COL - 1;
-    unsigned agent_row_id = m_row2id.indexOf(agent_id);
     QModelIndex cell_changed_start = createIndex(agent_row_id, first_column_index);
     QModelIndex cell_changed_end = createIndex(agent_row_id, last_column_index);
     emit dataChanged(cell_changed_start, cell_changed_end);
@@ -136,6 +177,21 @@ void AgentsModel::refreshColumn(int column_index)
     emit dataChanged(cell_changed_start, cell_changed_end);
 }
 
+/*! \brief emit one dataChanged per run of consecutive rows */
+void AgentsModel::refreshRows(QList<int> rows, int first_column, int last_column)
+{
+    qSort(rows);
+    int i = 0;
+    while (i < rows.size()) {
+        int first_row = rows[i];
+        int last_row = first_row;
+        while (++i < rows.size() && rows[i] == last_row + 1) {
+            last_row = rows[i];
+        }
+        emit dataChanged(createIndex(first_row, first_column), createIndex(last_row, last_column));
+    }
+}
+
 void AgentsModel::updateAgentListenStatus(const QString & /*ipbxid*/, const QString & /*agent_id*/, const QString & /*status*/)
 {
 }
@@ -430,10 +486,28 @@ QVariant AgentsModel::dataBackgroundPaused(enum AgentPauseStatus pause_status) c
     }
 }
 
+/*! \brief refresh the rows whose displayed availability changed since the last tick
+ *
+ * Logged out agents display no duration and are not repainted every second.
+ */
 void AgentsModel::increaseAvailability()
 {
-    this->refreshColumn(AVAILABILITY);
-    this->refreshColumn(STATUS_SINCE);
+    QList<int> changed_rows;
+    for (int row = 0 ; row < m_row2id.size() ; row ++) {
+        const QString &agent_id = m_row2id[row];
+        const AgentInfo * agent = b_engine->agent(agent_id);
+        if (agent == NULL) {
+            continue;
+        }
+        QString availability = this->dataDisplayAvailability(agent);
+        QString &displayed_availability = m_displayed_availability[agent_id];
+        if (availability != displayed_availability) {
+            displayed_availability = availability;
+            changed_rows.append(row);
+        }
+    }
+    // AVAILABILITY, STATUS_LABEL and STATUS_SINCE are adjacent
+    this->refreshRows(changed_rows, AVAILABILITY, STATUS_SINCE);
 }
 
 QStringList AgentsModel::dataDisplayQueueList(const QString &agent_id) const
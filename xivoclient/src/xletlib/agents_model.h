@@ -31,6 +31,8 @@
 #define __AGENTSMODEL_H__
 
 #include <QAbstractTableModel>
+#include <QHash>
+#include <QSet>
 #include <QStringList>
 
 #include <storage/agentinfo.h>
@@ -53,11 +55,12 @@ class XLETLIB_EXPORT AgentsModel : public QAbstractTableModel
         QVariant headerData(int,
                             Qt::Orientation,
                             int) const;
+        int rowOf(const QString &agent_id) const;
 
     public slots:
         void updateAgentConfig(const QString &);
         void removeAgentConfig(const QString &);
-        void updateAgentStatus(const QString &);
+        void updateAgentStatuses(const QSet<QString> &, quint32 fields);
         void refreshAgentRow(const QString & agent_id);
         void refreshColumn(int column_index);
         void updateAgentListenStatus(const QString &, const QString &, const QString &);
@@ -85,6 +88,7 @@ class XLETLIB_EXPORT AgentsModel : public QAbstractTableModel
         };
 
     private:
+        void refreshRows(QList<int> rows, int first_column, int last_column);
         QVariant dataDisplay(int row, int column) const;
         QVariant dataBackground(int row, int column) const;
         QVariant dataTooltip(int row, int column) const;
@@ -106,6 +110,8 @@ class XLETLIB_EXPORT AgentsModel : public QAbstractTableModel
 
         QString m_headers[NB_COL];
         QStringList m_row2id;
+        QHash<QString, int> m_id2row;                   //!< reverse of m_row2id
+        QHash<QString, QString> m_displayed_availability;  //!< availability shown at the last tick
         static QString not_available ;
 };
 
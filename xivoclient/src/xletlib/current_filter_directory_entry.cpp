@@ -43,6 +43,7 @@ CurrentFilterDirectoryEntry::CurrentFilterDirectoryEntry()
 void CurrentFilterDirectoryEntry::setSearchedText(const QString &searched_text)
 {
     this->m_searched_text = searched_text;
+    this->invalidate();
 }
 
 QString CurrentFilterDirectoryEntry::number() const
@@ -31,6 +31,11 @@
 
 #include "directory_entry.h"
 
+DirectoryEntry::DirectoryEntry()
+    : m_cached(false)
+{
+}
+
 void DirectoryEntry::setExtraFields(const QVariantMap &fields)
 {
     foreach (const QString &field_name, fields.keys()) {
@@ -40,15 +45,18 @@ void DirectoryEntry::setExtraFields(const QVariantMap &fields)
         const QString &value = fields[field_name].toString();
         m_extra_fields[field_name] = value;
     }
+    this->invalidate();
 }
 
 QString DirectoryEntry::getField(const QString &field_name, enum ColumnType type) const
 {
     switch(type) {
     case NAME:
-        return name();
+        this->fillCache();
+        return m_name;
     case NUMBER:
-        return number();
+        this->fillCache();
+        return m_number;
     case OTHER:
         return m_extra_fields[field_name];
     case STATUS_ICON:
@@ -61,3 +69,45 @@ QStringList DirectoryEntry::searchList() const
 {
     return QStringList() << this->name() << this->number() << m_extra_fields.values();
 }
+
+/*! \brief searchList() folded by fold(), for the directory filter */
+const QString &DirectoryEntry::searchKey() const
+{
+    this->fillCache();
+    return m_search_key;
+}
+
+/*! \brief to be called when the sources of the name or the number changed */
+void DirectoryEntry::invalidate()
+{
+    m_cached = false;
+}
+
+/*! \brief lower case text without accents, so that "Eloise" finds "Éloïse" */
+QString DirectoryEntry::fold(const QString &text)
+{
+    const QString &decomposed = text.normalized(QString::NormalizationForm_D);
+    QString folded;
+    folded.reserve(decomposed.size());
+    foreach (const QChar &c, decomposed) {
+        if (c.category() != QChar::Mark_NonSpacing) {
+            folded.append(c);
+        }
+    }
+    return folded.toCaseFolded();
+}
+
+void DirectoryEntry::fillCache() const
+{
+    if (m_cached) {
+        return;
+    }
+    m_name = this->name();
+    m_number = this->number();
+    QStringList folded_items;
+    foreach (const QString &item, this->searchList()) {
+        folded_items.append(fold(item));
+    }
+    m_search_key = folded_items.join("\n");
+    m_cached = true;
+}
@@ -52,6 +52,7 @@ enum ColumnType {
 class XLETLIB_EXPORT DirectoryEntry
 {
     public:
+        DirectoryEntry();
         virtual QString getField(const QString &field, enum ColumnType type) const;
         virtual QString number() const = 0;
         virtual QString name() const = 0;
@@ -65,8 +66,20 @@ class XLETLIB_EXPORT DirectoryEntry
         virtual void setExtraFields(const QVariantMap &fields);
         virtual ~DirectoryEntry() {}
 
+        const QString &searchKey() const;
+        void invalidate();
+
+        static QString fold(const QString &text);
+
     private:
+        void fillCache() const;
+
         QHash<QString, QString> m_extra_fields;
+
+        mutable bool m_cached;              //!< m_name, m_number and m_search_key are up to date
+        mutable QString m_name;
+        mutable QString m_number;
+        mutable QString m_search_key;       //!< folded searchList(), one line per item
 };
 
 #endif /* _LINE_DIRECTORY_ENTRY_H_ */
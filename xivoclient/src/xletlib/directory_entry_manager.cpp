@@ -48,19 +48,27 @@ DirectoryEntryManager::DirectoryEntryManager(const PhoneDAO &phone_dao,
 {
     this->registerListener("directory_search_result");
 
-    connect(b_engine, SIGNAL(updatePhoneConfig(const QString &)),
-            this, SLOT(updatePhone(const QString &)));
-    connect(b_engine, SIGNAL(updatePhoneStatus(const QString &)),
+    connect(b_engine, SIGNAL(updatePhoneConfig(const QString &, quint32)),
             this, SLOT(updatePhone(const QString &)));
+    connect(b_engine, SIGNAL(updatePhoneStatuses(const QSet<QString> &, quint32)),
+            this, SLOT(updatePhones(const QSet<QString> &)));
     connect(b_engine, SIGNAL(removePhoneConfig(const QString &)),
             this, SLOT(removePhone(const QString &)));
 
-    connect(b_engine, SIGNAL(updateUserConfig(const QString &)),
+    connect(b_engine, SIGNAL(updateUserConfig(const QString &, quint32)),
             this, SLOT(updateUser(const QString &)));
     connect(b_engine, SIGNAL(removeUserConfig(const QString &)),
             this, SLOT(removeUser(const QString &)));
 
     this->addEntry(&m_current_filter_directory_entry);
+
+    // phones and users received before the manager was created
+    foreach (const PhoneInfo *phone, b_engine->phones()) {
+        this->updatePhone(phone->xid());
+    }
+    foreach (const UserInfo *user, b_engine->users()) {
+        this->updateUser(user->xid());
+    }
 }
 
 const DirectoryEntry & DirectoryEntryManager::getEntry(int entry_index) const
@@ -74,28 +82,65 @@ int DirectoryEntryManager::entryCount() const
     return m_directory_entries.size();
 }
 
-template<class T>
-int DirectoryEntryManager::findEntryBy(const T looked_up) const
+const DirectorySearchIndex &DirectoryEntryManager::searchIndex() const
 {
-    for (int i = 0; i < m_directory_entries.size(); i++) {
-        const DirectoryEntry *entry = m_directory_entries[i];
-        if (entry->hasSource(looked_up)) {
-            return i;
-        }
+    return m_search_index;
+}
+
+QString DirectoryEntryManager::phoneKey(const QString &phone_xid)
+{
+    return QString("phone:%1").arg(phone_xid);
+}
+
+QString DirectoryEntryManager::userKey(const QString &user_xid)
+{
+    return QString("user:%1").arg(user_xid);
+}
+
+/*! \brief key identifying a lookup result by its content
+ *
+ * LookupDirectoryEntry::hasSource compares the whole result map, so the
+ * key is made of every field of the (sorted) map.
+ */
+QString DirectoryEntryManager::lookupKey(const QVariant &lookup_result)
+{
+    QStringList fields;
+    const QVariantMap &result = lookup_result.toMap();
+    for (QVariantMap::const_iterator it = result.constBegin(); it != result.constEnd(); ++it) {
+        fields << QString("%1=%2").arg(it.key()).arg(it.value().toString());
     }
-    return -1;
+    return QString("lookup:%1").arg(fields.join(QChar(0x1f)));
+}
+
+QString DirectoryEntryManager::nameAndNumberKey(const QString &name, const QString &number)
+{
+    return QString("%1%2%3").arg(name).arg(QChar(0x1f)).arg(number);
+}
+
+int DirectoryEntryManager::rowOf(const DirectoryEntry *entry) const
+{
+    return m_entry_rows.value(entry, -1);
+}
+
+int DirectoryEntryManager::findEntryByPhone(const QString &phone_xid) const
+{
+    return this->rowOf(m_entries_by_source.value(phoneKey(phone_xid)));
+}
+
+int DirectoryEntryManager::findEntryByUser(const QString &user_xid) const
+{
+    return this->rowOf(m_entries_by_source.value(userKey(user_xid)));
 }
 
-template<class T>
-int DirectoryEntryManager::hasEntry(const T looked_up) const
+int DirectoryEntryManager::findEntryByLookup(const QVariant &lookup_result) const
 {
-    return this->findEntryBy(looked_up) != -1;
+    return this->rowOf(m_entries_by_source.value(lookupKey(lookup_result)));
 }
 
 void DirectoryEntryManager::updateSearch(const QString &current_search)
 {
     m_current_filter_directory_entry.setSearchedText(current_search);
-    int matching_entry_index = this->findEntryBy(current_search);
+    int matching_entry_index = this->rowOf(&m_current_filter_directory_entry);
     this->updateEntryAt(matching_entry_index);
 }
 
@@ -107,14 +152,37 @@ void DirectoryEntryManager::updatePhone(const QString &phone_xid)
         return;
     }
 
-    int matching_entry_index = this->findEntryBy(phone);
+    int matching_entry_index = this->findEntryByPhone(phone_xid);
     if (matching_entry_index == -1) {
-        this->addEntry(new LineDirectoryEntry(*phone, m_user_dao, m_phone_dao));
+        this->addEntry(new LineDirectoryEntry(*phone, m_user_dao, m_phone_dao), phoneKey(phone_xid));
     } else {
         this->updateEntryAt(matching_entry_index);
     }
 }
 
+void DirectoryEntryManager::updatePhones(const QSet<QString> &phone_xids)
+{
+    int first_entry_index = m_directory_entries.size();
+    int last_entry_index = -1;
+    foreach (const QString &phone_xid, phone_xids) {
+        int matching_entry_index = this->findEntryByPhone(phone_xid);
+        if (matching_entry_index == -1) {
+            const PhoneInfo *phone = this->m_phone_dao.findByXId(phone_xid);
+            if (phone != NULL) {
+                this->addEntry(new LineDirectoryEntry(*phone, m_user_dao, m_phone_dao), phoneKey(phone_xid));
+            }
+        } else {
+            first_entry_index = qMin(first_entry_index, matching_entry_index);
+            last_entry_index = qMax(last_entry_index, matching_entry_index);
+        }
+    }
+    if (last_entry_index == -1) {
+        return;
+    }
+
+    emit directoryEntriesUpdated(first_entry_index, last_entry_index);
+}
+
 void DirectoryEntryManager::updateUser(const QString &user_xid)
 {
     const UserInfo *user = this->m_user_dao.findByXId(user_xid);
@@ -123,12 +191,20 @@ void DirectoryEntryManager::updateUser(const QString &user_xid)
         return;
     }
 
-    int matching_entry_index = this->findEntryBy(user);
+    // the user name is displayed on its lines too
+    foreach (const QString &phone_xid, user->phonelist()) {
+        int line_entry_index = this->findEntryByPhone(phone_xid);
+        if (line_entry_index != -1) {
+            this->updateEntryAt(line_entry_index);
+        }
+    }
+
+    int matching_entry_index = this->findEntryByUser(user_xid);
     if (matching_entry_index == -1) {
         if (! user->hasMobile()) {
             return;
         }
-        this->addEntry(new MobileDirectoryEntry(*user));
+        this->addEntry(new MobileDirectoryEntry(*user), userKey(user_xid));
     } else if (user->hasMobile()) {
         this->updateEntryAt(matching_entry_index);
     } else {
@@ -138,13 +214,7 @@ void DirectoryEntryManager::updateUser(const QString &user_xid)
 
 void DirectoryEntryManager::removePhone(const QString &phone_xid)
 {
-    const PhoneInfo *phone = this->m_phone_dao.findByXId(phone_xid);
-    if (phone == NULL) {
-        qDebug() << Q_FUNC_INFO << "phone" << phone_xid << "is null";
-        return;
-    }
-
-    int matching_entry_index = this->findEntryBy(phone);
+    int matching_entry_index = this->findEntryByPhone(phone_xid);
     if (matching_entry_index == -1) {
         qDebug() << Q_FUNC_INFO << "removed phone" << phone_xid << "not in cache";
     } else {
@@ -154,13 +224,7 @@ void DirectoryEntryManager::removePhone(const QString &phone_xid)
 
 void DirectoryEntryManager::removeUser(const QString &user_xid)
 {
-    const UserInfo *user = this->m_user_dao.findByXId(user_xid);
-    if (user == NULL) {
-        qDebug() << Q_FUNC_INFO << "user" << user_xid << "is null";
-        return;
-    }
-
-    int matching_entry_index = this->findEntryBy(user);
+    int matching_entry_index = this->findEntryByUser(user_xid);
     if (matching_entry_index != -1) {
         this->removeEntryAt(matching_entry_index);
     }
@@ -168,19 +232,41 @@ void DirectoryEntryManager::removeUser(const QString &user_xid)
 
 int DirectoryEntryManager::findEntryByNameAndNumber(const QString &name, const QString &number) const
 {
-    for (int i = 0; i < m_directory_entries.size(); i++) {
-        DirectoryEntry *entry = m_directory_entries[i];
-        if (! entry) {
-            continue;
-        }
-        if (entry->name().isEmpty()) {
-            continue;
-        }
-        if (entry->name() == name && entry->number() == number) {
-            return i;
+    if (name.isEmpty()) {
+        return -1;
+    }
+
+    int first_matching_index = -1;
+    foreach (const DirectoryEntry *entry, m_entries_by_name_and_number.values(nameAndNumberKey(name, number))) {
+        int index = this->rowOf(entry);
+        if (first_matching_index == -1 || index < first_matching_index) {
+            first_matching_index = index;
         }
     }
-    return -1;
+    return first_matching_index;
+}
+
+void DirectoryEntryManager::indexNameAndNumber(const DirectoryEntry *entry)
+{
+    const QString &name = entry->name();
+    const QString &key = name.isEmpty() ? QString() : nameAndNumberKey(name, entry->number());
+    if (key == m_name_and_number_keys.value(entry)) {
+        return;
+    }
+
+    this->unindexNameAndNumber(entry);
+    if (! key.isEmpty()) {
+        m_entries_by_name_and_number.insert(key, entry);
+        m_name_and_number_keys.insert(entry, key);
+    }
+}
+
+void DirectoryEntryManager::unindexNameAndNumber(const DirectoryEntry *entry)
+{
+    const QString &key = m_name_and_number_keys.take(entry);
+    if (! key.isEmpty()) {
+        m_entries_by_name_and_number.remove(key, entry);
+    }
 }
 
 void DirectoryEntryManager::parseCommand(const QVariantMap &result)
@@ -194,32 +280,59 @@ void DirectoryEntryManager::parseCommand(const QVariantMap &result)
             DirectoryEntry *matching_entry = m_directory_entries[matching_entry_index];
             matching_entry->setExtraFields(entry.toMap());
             this->updateEntryAt(matching_entry_index);
-        } else if (! this->hasEntry(entry)) {
-            this->addEntry(new LookupDirectoryEntry(entry));
+        } else if (this->findEntryByLookup(entry) == -1) {
+            this->addEntry(new LookupDirectoryEntry(entry), lookupKey(entry));
         }
     }
 }
 
-void DirectoryEntryManager::addEntry(DirectoryEntry *entry)
+void DirectoryEntryManager::addEntry(DirectoryEntry *entry, const QString &source_key)
 {
     if (! entry) {
         qDebug() << Q_FUNC_INFO << "Tried to add a NULL entry";
         return;
     }
     m_directory_entries.append(entry);
+    m_entry_rows.insert(entry, m_directory_entries.size() - 1);
+    if (! source_key.isEmpty()) {
+        m_entries_by_source.insert(source_key, entry);
+        m_source_keys.insert(entry, source_key);
+    }
+    this->indexNameAndNumber(entry);
+    m_search_index.update(entry);
 
     emit directoryEntryAdded(m_directory_entries.size() - 1);
 }
 
 void DirectoryEntryManager::updateEntryAt(int index)
 {
+    DirectoryEntry *entry = m_directory_entries.at(index);
+    entry->invalidate();
+    this->indexNameAndNumber(entry);
+    m_search_index.update(entry);
+
     emit directoryEntryUpdated(index);
 }
 
+/*! \brief remove the entry at index
+ *
+ * Entry indexes are the rows of DirectoryEntryModel and have to stay
+ * contiguous, so only the rows after the removed entry are renumbered.
+ */
 void DirectoryEntryManager::removeEntryAt(int index)
 {
     const DirectoryEntry *entry = m_directory_entries.at(index);
     m_directory_entries.removeAt(index);
+    m_entry_rows.remove(entry);
+    for (int i = index; i < m_directory_entries.size(); i++) {
+        m_entry_rows[m_directory_entries[i]] = i;
+    }
+    const QString &source_key = m_source_keys.take(entry);
+    if (! source_key.isEmpty()) {
+        m_entries_by_source.remove(source_key);
+    }
+    this->unindexNameAndNumber(entry);
+    m_search_index.remove(entry);
     delete entry;
     entry = NULL;
 
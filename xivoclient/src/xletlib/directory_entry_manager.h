@@ -30,7 +30,9 @@
 #ifndef _DIRECTORY_ENTRY_MANAGER_H_
 #define _DIRECTORY_ENTRY_MANAGER_H_
 
+#include <QHash>
 #include <QObject>
+#include <QSet>
 #include <QString>
 #include <QStringList>
 
@@ -40,6 +42,7 @@
 #include <dao/userdaoimpl.h>
 
 #include <xletlib/directory_entry.h>
+#include <xletlib/directory_search_index.h>
 #include <xletlib/xletlib_export.h>
 
 #include <xletlib/current_filter_directory_entry.h>
@@ -57,11 +60,13 @@ class XLETLIB_EXPORT DirectoryEntryManager: public QObject, public IPBXListener
                               QObject *parent=NULL);
         const DirectoryEntry & getEntry(int entry_index) const;
         int entryCount() const;
+        const DirectorySearchIndex &searchIndex() const;
 
     public slots:
         void updateSearch(const QString &current_search);
 
         void updatePhone(const QString &phone_xid);
+        void updatePhones(const QSet<QString> &phone_xids);
         void removePhone(const QString &phone_xid);
 
         void updateUser(const QString &user_xid);
@@ -72,25 +77,37 @@ class XLETLIB_EXPORT DirectoryEntryManager: public QObject, public IPBXListener
     signals:
         void directoryEntryAdded(int entry_index);
         void directoryEntryUpdated(int entry_index);
+        void directoryEntriesUpdated(int first_entry_index, int last_entry_index);
         void directoryEntryDeleted(int entry_index);
 
     protected:
-        template<class T>
-        int findEntryBy(const T) const;
-
-        template<class T>
-        int hasEntry(const T) const;
-
+        int findEntryByPhone(const QString &phone_xid) const;
+        int findEntryByUser(const QString &user_xid) const;
+        int findEntryByLookup(const QVariant &lookup_result) const;
         int findEntryByNameAndNumber(const QString &name, const QString &number) const;
+        int rowOf(const DirectoryEntry *entry) const;
 
-        void addEntry(DirectoryEntry *new_entry);
+        void addEntry(DirectoryEntry *new_entry, const QString &source_key = QString());
         void updateEntryAt(int index);
         void removeEntryAt(int index);
 
+        static QString phoneKey(const QString &phone_xid);
+        static QString userKey(const QString &user_xid);
+        static QString lookupKey(const QVariant &lookup_result);
+        static QString nameAndNumberKey(const QString &name, const QString &number);
+        void indexNameAndNumber(const DirectoryEntry *entry);
+        void unindexNameAndNumber(const DirectoryEntry *entry);
+
         const PhoneDAO &m_phone_dao;
         const UserDAO &m_user_dao;
         QList<DirectoryEntry *> m_directory_entries;
+        QHash<const DirectoryEntry *, int> m_entry_rows;            //!< entry -> index in m_directory_entries
+        QHash<QString, DirectoryEntry *> m_entries_by_source;      //!< phoneKey, userKey or lookupKey -> entry
+        QHash<const DirectoryEntry *, QString> m_source_keys;      //!< entry -> its key in m_entries_by_source
+        QMultiHash<QString, const DirectoryEntry *> m_entries_by_name_and_number; //!< non empty name and number -> entries
+        QHash<const DirectoryEntry *, QString> m_name_and_number_keys; //!< entry -> key it is indexed under
         CurrentFilterDirectoryEntry m_current_filter_directory_entry;
+        DirectorySearchIndex m_search_index;
 };
 
 #endif /* _DIRECTORY_ENTRY_MANAGER_H_ */
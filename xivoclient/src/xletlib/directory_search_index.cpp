@@ -0,0 +1,127 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <xletlib/directory_entry.h>
+
+#include "directory_search_index.h"
+
+DirectorySearchIndex::DirectorySearchIndex()
+    : m_revision(0)
+{
+}
+
+/*! \brief index the current search key of entry */
+void DirectorySearchIndex::update(const DirectoryEntry *entry)
+{
+    const QSet<QString> &new_grams = grams(entry->searchKey());
+    QSet<QString> &entry_grams = m_entry_grams[entry];
+    if (new_grams == entry_grams) {
+        return;
+    }
+
+    foreach (const QString &gram, entry_grams - new_grams) {
+        QSet<const DirectoryEntry *> &entries = m_entries_by_gram[gram];
+        entries.remove(entry);
+        if (entries.isEmpty()) {
+            m_entries_by_gram.remove(gram);
+        }
+    }
+    foreach (const QString &gram, new_grams - entry_grams) {
+        m_entries_by_gram[gram].insert(entry);
+    }
+    entry_grams = new_grams;
+    m_revision++;
+}
+
+void DirectorySearchIndex::remove(const DirectoryEntry *entry)
+{
+    if (! m_entry_grams.contains(entry)) {
+        return;
+    }
+
+    foreach (const QString &gram, m_entry_grams.take(entry)) {
+        QSet<const DirectoryEntry *> &entries = m_entries_by_gram[gram];
+        entries.remove(entry);
+        if (entries.isEmpty()) {
+            m_entries_by_gram.remove(gram);
+        }
+    }
+    m_revision++;
+}
+
+/*! \brief the entries having every trigram of folded_filter
+ *
+ * The candidates still have to be checked with QString::contains, the
+ * trigrams may not be contiguous in their key.
+ */
+QSet<const DirectoryEntry *> DirectorySearchIndex::candidates(const QString &folded_filter) const
+{
+    QList<const QSet<const DirectoryEntry *> *> postings;
+    foreach (const QString &gram, grams(folded_filter)) {
+        QHash<QString, QSet<const DirectoryEntry *> >::const_iterator it = m_entries_by_gram.find(gram);
+        if (it == m_entries_by_gram.constEnd()) {
+            return QSet<const DirectoryEntry *>();
+        }
+        postings.append(&it.value());
+    }
+    if (postings.isEmpty()) {
+        return QSet<const DirectoryEntry *>();
+    }
+
+    const QSet<const DirectoryEntry *> *smallest = postings.first();
+    foreach (const QSet<const DirectoryEntry *> *posting, postings) {
+        if (posting->size() < smallest->size()) {
+            smallest = posting;
+        }
+    }
+    QSet<const DirectoryEntry *> result = *smallest;
+    foreach (const QSet<const DirectoryEntry *> *posting, postings) {
+        if (posting != smallest) {
+            result.intersect(*posting);
+        }
+    }
+    return result;
+}
+
+int DirectorySearchIndex::revision() const
+{
+    return m_revision;
+}
+
+QSet<QString> DirectorySearchIndex::grams(const QString &text)
+{
+    QSet<QString> result;
+    for (int i = 0; i + gram_length <= text.size(); i++) {
+        const QString &gram = text.mid(i, gram_length);
+        if (! gram.contains('\n')) {
+            result.insert(gram);
+        }
+    }
+    return result;
+}
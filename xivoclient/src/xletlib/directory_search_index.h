@@ -0,0 +1,66 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _DIRECTORY_SEARCH_INDEX_H_
+#define _DIRECTORY_SEARCH_INDEX_H_
+
+#include <QHash>
+#include <QSet>
+#include <QString>
+
+#include <xletlib/xletlib_export.h>
+
+class DirectoryEntry;
+
+/*! \brief trigram index of the directory entries search keys
+ *
+ * Gives the entries that may contain a filter of at least gram_length
+ * characters. Shorter filters match too many entries for an index to help.
+ */
+class XLETLIB_EXPORT DirectorySearchIndex
+{
+    public:
+        static const int gram_length = 3;
+
+        DirectorySearchIndex();
+
+        void update(const DirectoryEntry *entry);
+        void remove(const DirectoryEntry *entry);
+        QSet<const DirectoryEntry *> candidates(const QString &folded_filter) const;
+        int revision() const;
+
+    private:
+        static QSet<QString> grams(const QString &text);
+
+        QHash<QString, QSet<const DirectoryEntry *> > m_entries_by_gram;
+        QHash<const DirectoryEntry *, QSet<QString> > m_entry_grams;
+        int m_revision;                 //!< changes each time the index changes
+};
+
+#endif /* _DIRECTORY_SEARCH_INDEX_H_ */
@@ -0,0 +1,154 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QIcon>
+#include <QImage>
+#include <QImageReader>
+#include <QPaintDevice>
+#include <QPainter>
+
+#include "icon_cache.h"
+
+IconCache::Key::Key(const QString &resource, const QSize &size, const QColor &tint,
+                    qreal device_pixel_ratio, Style style)
+    : resource(resource),
+      size(size),
+      tint(tint.isValid() ? tint.rgba() : 0),
+      device_pixel_ratio(device_pixel_ratio),
+      style(style)
+{
+}
+
+bool IconCache::Key::operator==(const Key &other) const
+{
+    return tint == other.tint
+        && size == other.size
+        && device_pixel_ratio == other.device_pixel_ratio
+        && style == other.style
+        && resource == other.resource;
+}
+
+uint qHash(const IconCache::Key &key)
+{
+    uint hash = qHash(key.resource);
+    hash = hash * 31 + uint(key.size.width() << 16 | key.size.height());
+    hash = hash * 31 + key.tint;
+    hash = hash * 31 + uint(key.device_pixel_ratio * 100);
+    return hash * 31 + uint(key.style);
+}
+
+QCache<IconCache::Key, QPixmap> &IconCache::cache()
+{
+    static QCache<Key, QPixmap> pixmaps(max_cost_kb);
+    return pixmaps;
+}
+
+/*! \brief the icon at resource, rendered at size and tinted with tint
+ *
+ * tint is ignored when invalid. The returned pixmap has size * device_pixel_ratio
+ * pixels and paints as size on a device of that ratio.
+ */
+QPixmap IconCache::pixmap(const QString &resource,
+                          const QSize &size,
+                          const QColor &tint,
+                          qreal device_pixel_ratio)
+{
+    Key key(resource, size, tint, device_pixel_ratio);
+
+    QPixmap result;
+    if (! find(key, &result)) {
+        result = render(resource, size, tint, device_pixel_ratio);
+        insert(key, result);
+    }
+    return result;
+}
+
+//! the icon for painting with painter, at the pixel ratio of its device
+QPixmap IconCache::pixmap(const QString &resource,
+                          const QSize &size,
+                          const QColor &tint,
+                          const QPainter *painter)
+{
+    qreal device_pixel_ratio = 1.0;
+    if (painter != NULL && painter->device() != NULL) {
+        device_pixel_ratio = painter->device()->devicePixelRatio();
+    }
+    return pixmap(resource, size, tint, device_pixel_ratio);
+}
+
+bool IconCache::find(const Key &key, QPixmap *pixmap)
+{
+    QPixmap *cached = cache().object(key);
+    if (cached == NULL) {
+        return false;
+    }
+    *pixmap = *cached;
+    return true;
+}
+
+void IconCache::insert(const Key &key, const QPixmap &pixmap)
+{
+    int cost_kb = qMax(1, pixmap.width() * pixmap.height() * pixmap.depth() / 8 / 1024);
+    cache().insert(key, new QPixmap(pixmap), cost_kb);
+}
+
+int IconCache::count()
+{
+    return cache().count();
+}
+
+void IconCache::clear()
+{
+    cache().clear();
+}
+
+QPixmap IconCache::render(const QString &resource, const QSize &size,
+                          const QColor &tint, qreal device_pixel_ratio)
+{
+    QSize pixel_size = size * device_pixel_ratio;
+
+    QImageReader reader(resource);
+    reader.setScaledSize(pixel_size);
+    QImage image = reader.read();
+    if (image.isNull()) {
+        image = QIcon(resource).pixmap(pixel_size).toImage();
+    }
+    image = image.convertToFormat(QImage::Format_ARGB32_Premultiplied);
+
+    if (tint.isValid()) {
+        QPainter tint_painter(&image);
+        tint_painter.setCompositionMode(QPainter::CompositionMode_SourceAtop);
+        tint_painter.fillRect(image.rect(), tint);
+        tint_painter.end();
+    }
+
+    QPixmap result = QPixmap::fromImage(image);
+    result.setDevicePixelRatio(device_pixel_ratio);
+    return result;
+}
@@ -0,0 +1,95 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef _ICON_CACHE_H_
+#define _ICON_CACHE_H_
+
+#include <QCache>
+#include <QColor>
+#include <QPixmap>
+#include <QSize>
+#include <QString>
+
+#include <xletlib/xletlib_export.h>
+
+class QPainter;
+
+/*! \brief rasterized and tinted icons shared by the delegates and models
+ *
+ * Painting a cell used to load the icon, rasterize it and tint it every
+ * time. The results are kept here by resource, size, tint and device pixel
+ * ratio, up to max_cost_kb kilobytes of pixmaps, the least recently used
+ * ones being dropped first.
+ */
+class XLETLIB_EXPORT IconCache
+{
+    public:
+        static const int max_cost_kb = 4096;
+
+        //! what a cached pixmap was rendered from
+        struct Key {
+            enum Style {
+                TINTED,     //!< rendered by pixmap()
+                TAINTED     //!< rendered by TaintedPixmap
+            };
+
+            Key(const QString &resource, const QSize &size, const QColor &tint,
+                qreal device_pixel_ratio, Style style = TINTED);
+            bool operator==(const Key &other) const;
+
+            QString resource;
+            QSize size;
+            QRgb tint;                  //!< 0 when not tinted, which renders the same
+            qreal device_pixel_ratio;
+            Style style;
+        };
+
+        static QPixmap pixmap(const QString &resource,
+                              const QSize &size,
+                              const QColor &tint = QColor(),
+                              qreal device_pixel_ratio = 1.0);
+        static QPixmap pixmap(const QString &resource,
+                              const QSize &size,
+                              const QColor &tint,
+                              const QPainter *painter);
+
+        static bool find(const Key &key, QPixmap *pixmap);
+        static void insert(const Key &key, const QPixmap &pixmap);
+        static int count();
+        static void clear();
+
+    private:
+        static QCache<Key, QPixmap> &cache();
+        static QPixmap render(const QString &resource, const QSize &size,
+                              const QColor &tint, qreal device_pixel_ratio);
+};
+
+XLETLIB_EXPORT uint qHash(const IconCache::Key &key);
+
+#endif
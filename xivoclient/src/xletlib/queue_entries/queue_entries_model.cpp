@@ -27,6 +27,7 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <QSet>
 #include <QTimer>
 
 #include <baseengine.h>
@@ -84,12 +85,21 @@ bool QueueEntriesModel::removeRows(int start_row_index, int row_count, const QMo
     beginRemoveRows(index, start_row_index, start_row_index + row_count - 1);
     for (int row = start_row_index; row < start_row_index + row_count; row ++) {
         ret = ret && start_row_index < m_entries.size();
-        m_entries.removeAt(start_row_index);
+        if (start_row_index < m_entries.size()) {
+            m_rows.remove(m_entries.takeAt(start_row_index).unique_id);
+        }
     }
+    this->indexRows(start_row_index, m_entries.size() - 1);
     endRemoveRows();
     return ret;
 }
 
+/*! \brief apply the new entries of the watched queue
+ *
+ * Entries are matched by uniqueid, so that only the rows of the calls
+ * that left, moved, arrived or changed are touched and the selection is
+ * kept.
+ */
 void QueueEntriesModel::queueEntryUpdate(const QString & queue_id,
                                          const QVariantList & entry_list)
 {
@@ -97,16 +107,82 @@ void QueueEntriesModel::queueEntryUpdate(const QString & queue_id,
         return;
     }
 
-    if (this->rowCount(QModelIndex()) > 0) {
-        this->removeRows(0, this->rowCount(QModelIndex()), QModelIndex());
+    QList<QueueEntry> new_entries;
+    QSet<QString> new_unique_ids;
+    foreach (const QVariant &entry, entry_list) {
+        new_entries.append(entryFromMap(entry.toMap()));
+        new_unique_ids.insert(new_entries.last().unique_id);
+    }
+
+    for (int row = m_entries.size() - 1; row >= 0; row--) {
+        if (! new_unique_ids.contains(m_entries[row].unique_id)) {
+            this->removeRows(row, 1, QModelIndex());
+        }
+    }
+
+    QList<int> changed_rows;
+    for (int row = 0; row < new_entries.size(); row++) {
+        const QueueEntry &entry = new_entries[row];
+        int current_row = this->rowOf(entry.unique_id);
+        // a row before row is a duplicate uniqueid already placed
+        if (current_row == -1 || current_row < row) {
+            beginInsertRows(QModelIndex(), row, row);
+            m_entries.insert(row, entry);
+            this->indexRows(row, m_entries.size() - 1);
+            endInsertRows();
+            continue;
+        }
+        if (current_row != row) {
+            // rows before row are already in place, so the entry moves up
+            beginMoveRows(QModelIndex(), current_row, current_row, QModelIndex(), row);
+            m_entries.move(current_row, row);
+            this->indexRows(row, current_row);
+            endMoveRows();
+        }
+        if (this->setEntryAt(row, entry)) {
+            changed_rows.append(row);
+        }
     }
-    if (entry_list.size() > 0) {
-        beginInsertRows(QModelIndex(), 0, entry_list.size() - 1);
-        m_entries = entry_list;
-        endInsertRows();
+    this->refreshRows(changed_rows, 0, NB_COL - 1);
+}
+
+QueueEntriesModel::QueueEntry QueueEntriesModel::entryFromMap(const QVariantMap & entry_map)
+{
+    QueueEntry entry;
+    entry.unique_id = entry_map.value("uniqueid").toString();
+    entry.position = entry_map.value("position").toInt();
+    entry.name = entry_map.value("name").toString();
+    entry.number = entry_map.value("number").toString();
+    entry.join_time = entry_map.value("join_time").toDouble();
+    entry.time = b_engine->timeElapsed(entry.join_time);
+    return entry;
+}
+
+int QueueEntriesModel::rowOf(const QString & unique_id) const
+{
+    return m_rows.value(unique_id, -1);
+}
+
+//! store the row of the entries from first_row to last_row after they moved
+void QueueEntriesModel::indexRows(int first_row, int last_row)
+{
+    for (int row = first_row; row <= last_row; row++) {
+        m_rows[m_entries[row].unique_id] = row;
     }
 }
 
+/*! \brief replace the entry at row, returns true if anything displayed changed */
+bool QueueEntriesModel::setEntryAt(int row, const QueueEntry & entry)
+{
+    QueueEntry &current = m_entries[row];
+    bool changed = current.position != entry.position
+        || current.name != entry.name
+        || current.number != entry.number
+        || current.time != entry.time;
+    current = entry;
+    return changed;
+}
+
 void QueueEntriesModel::changeWatchedQueue(const QString & queue_id)
 {
     this->subscribeQueueEntry(queue_id);
@@ -128,20 +204,20 @@ QVariant QueueEntriesModel::data(const QModelIndex & index, int role) const
 
 QVariant QueueEntriesModel::dataDisplay(int row, int column) const
 {
-    QVariantMap entry = this->m_entries[row].toMap();
+    const QueueEntry &entry = this->m_entries[row];
     switch(column) {
     case ID:
         return row;
     case POSITION:
-        return entry.value("position");
+        return entry.position;
     case NAME:
-        return entry.value("name");
+        return entry.name;
     case NUMBER:
-        return entry.value("number");
+        return entry.number;
     case TIME:
-        return b_engine->timeElapsed(entry.value("join_time").toDouble());
+        return entry.time;
     case UNIQUE_ID:
-        return entry.value("uniqueid");
+        return entry.unique_id;
     default:
         return QVariant();
     }
@@ -181,14 +257,29 @@ void QueueEntriesModel::subscribeQueueEntry(const QString & queue_id)
 
 void QueueEntriesModel::increaseTime()
 {
-    this->refreshColumn(TIME);
+    QList<int> changed_rows;
+    for (int row = 0; row < m_entries.size(); row++) {
+        QueueEntry &entry = m_entries[row];
+        const QString &time = b_engine->timeElapsed(entry.join_time);
+        if (time != entry.time) {
+            entry.time = time;
+            changed_rows.append(row);
+        }
+    }
+    this->refreshRows(changed_rows, TIME, TIME);
 }
 
-void QueueEntriesModel::refreshColumn(int column_index)
+/*! \brief emit one dataChanged per run of consecutive rows, rows being sorted */
+void QueueEntriesModel::refreshRows(const QList<int> & rows, int first_column, int last_column)
 {
-    unsigned first_row_index = 0;
-    unsigned last_row_index = m_entries.size() - 1;
-    QModelIndex cell_changed_start = createIndex(first_row_index, column_index);
-    QModelIndex cell_changed_end = createIndex(last_row_index, column_index);
-    emit dataChanged(cell_changed_start, cell_changed_end);
+    int i = 0;
+    while (i < rows.size()) {
+        int first_row = rows[i];
+        int last_row = first_row;
+        while (i + 1 < rows.size() && rows[i + 1] == last_row + 1) {
+            last_row = rows[++i];
+        }
+        emit dataChanged(createIndex(first_row, first_column), createIndex(last_row, last_column));
+        i++;
+    }
 }
@@ -30,6 +30,8 @@
 #include <QStringList>
 #include <QAbstractTableModel>
 #include <QDebug>
+#include <QHash>
+#include <QList>
 
 #include <xletlib/xletlib_export.h>
 
@@ -60,9 +62,22 @@ class XLETLIB_EXPORT QueueEntriesModel : public QAbstractTableModel
         void increaseTime();
 
     private:
+        struct QueueEntry {
+            QString unique_id;
+            int position;
+            QString name;
+            QString number;
+            double join_time;
+            QString time;       //!< join_time as last displayed
+        };
+
+        static QueueEntry entryFromMap(const QVariantMap & entry_map);
+        int rowOf(const QString & unique_id) const;
+        void indexRows(int first_row, int last_row);
+        bool setEntryAt(int row, const QueueEntry & entry);
         QVariant dataDisplay(int row, int column) const;
         void subscribeQueueEntry(const QString & queue_id);
-        void refreshColumn(int column_index);
+        void refreshRows(const QList<int> & rows, int first_column, int last_column);
 
     public:
         enum Columns {
@@ -77,6 +92,7 @@ class XLETLIB_EXPORT QueueEntriesModel : public QAbstractTableModel
 
         QString m_headers[NB_COL];
         QString m_queue_id;
-        QVariantList m_entries;
+        QList<QueueEntry> m_entries;
+        QHash<QString, int> m_rows;  //!< unique id -> row in m_entries
         static QString not_available ;
 };
@@ -27,17 +27,16 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include "icon_cache.h"
 #include "taintedpixmap.h"
 
-QHash<QString, QPixmap> TaintedPixmap::m_pixmap_cache = QHash <QString, QPixmap>();
-
 TaintedPixmap::TaintedPixmap(const QString &pixmap_path, const QColor &tint_color)
 {
-    m_pixmap_hash = pixmap_path + tint_color.name();
+    IconCache::Key key(pixmap_path, QSize(), tint_color, 1.0, IconCache::Key::TAINTED);
 
-    if (!m_pixmap_cache.contains(m_pixmap_hash)) {
-        QPixmap tainted_pixmap = this->createTaintedPixmap(pixmap_path, tint_color);
-        m_pixmap_cache.insert(m_pixmap_hash, tainted_pixmap);
+    if (! IconCache::find(key, &m_pixmap)) {
+        m_pixmap = this->createTaintedPixmap(pixmap_path, tint_color);
+        IconCache::insert(key, m_pixmap);
     }
 }
 
@@ -90,5 +89,5 @@ QPixmap TaintedPixmap::createTaintedPixmapMacOnly(const QString &pixmap_path, co
 
 QPixmap TaintedPixmap::getPixmap()
 {
-    return m_pixmap_cache.value(m_pixmap_hash);
+    return m_pixmap;
 }
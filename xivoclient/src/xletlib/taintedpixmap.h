@@ -44,9 +44,7 @@ class XLETLIB_EXPORT TaintedPixmap : public QPixmap
         QPixmap createTaintedPixmapNotMac(const QString &pixmap_path, const QColor &tint_color);
         QPixmap createTaintedPixmapMacOnly(const QString &pixmap_path, const QColor &tint_color);
 
-        static QHash<QString, QPixmap> m_pixmap_cache;
-
-        QString m_pixmap_hash;
+        QPixmap m_pixmap;
 };
 
 #endif
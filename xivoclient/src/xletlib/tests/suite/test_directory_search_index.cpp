@@ -0,0 +1,139 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+#include <QPixmap>
+
+#include "test_directory_search_index.h"
+
+#include <xletlib/directory_entry.h>
+#include <xletlib/directory_search_index.h>
+
+namespace {
+
+class FakeDirectoryEntry: public DirectoryEntry
+{
+    public:
+        FakeDirectoryEntry(const QString &name, const QString &number)
+            : m_name(name), m_number(number) {}
+        QString number() const { return m_number; }
+        QString name() const { return m_name; }
+        QPixmap statusIcon() const { return QPixmap(); }
+        QString statusText() const { return QString(); }
+        void setName(const QString &name) { m_name = name; }
+
+    private:
+        QString m_name;
+        QString m_number;
+};
+
+}
+
+void TestDirectorySearchIndex::testFold()
+{
+    QCOMPARE(DirectoryEntry::fold(QString::fromUtf8("Éloïse Lévesque")), QString("eloise levesque"));
+}
+
+void TestDirectorySearchIndex::testCandidates()
+{
+    FakeDirectoryEntry alice(QString::fromUtf8("Alice Trémblay"), "1001");
+    FakeDirectoryEntry bob("Bob Lebrun", "1002");
+    DirectorySearchIndex index;
+    index.update(&alice);
+    index.update(&bob);
+
+    QSet<const DirectoryEntry *> expected;
+    expected.insert(&alice);
+
+    QCOMPARE(index.candidates("tremb"), expected);
+    QCOMPARE(index.candidates("100").size(), 2);
+    QVERIFY(index.candidates("xyz").isEmpty());
+
+    index.remove(&alice);
+
+    QVERIFY(index.candidates("tremb").isEmpty());
+}
+
+void TestDirectorySearchIndex::testUpdate()
+{
+    FakeDirectoryEntry entry("Alice", "1001");
+    DirectorySearchIndex index;
+    index.update(&entry);
+    int revision = index.revision();
+
+    entry.setName("Bob");
+    index.update(&entry);
+
+    QCOMPARE(index.revision(), revision);
+    QCOMPARE(index.candidates("bob").size(), 0);
+
+    entry.invalidate();
+    index.update(&entry);
+
+    QVERIFY(index.revision() != revision);
+    QCOMPARE(index.candidates("bob").size(), 1);
+    QCOMPARE(index.candidates("ali").size(), 0);
+}
+
+void TestDirectorySearchIndex::benchmarkFilter_data()
+{
+    QTest::addColumn<int>("entry_count");
+
+    QTest::newRow("100 entries") << 100;
+    QTest::newRow("1000 entries") << 1000;
+    QTest::newRow("10000 entries") << 10000;
+}
+
+void TestDirectorySearchIndex::benchmarkFilter()
+{
+    QFETCH(int, entry_count);
+
+    QList<FakeDirectoryEntry *> entries;
+    DirectorySearchIndex index;
+    for (int i = 0; i < entry_count; i++) {
+        entries.append(new FakeDirectoryEntry(QString("User %1 Tremblay").arg(i),
+                                              QString::number(10000 + i)));
+        index.update(entries.last());
+    }
+
+    int matches = 0;
+    QBENCHMARK {
+        const QString &filter = DirectoryEntry::fold("user 42");
+        const QSet<const DirectoryEntry *> &candidates = index.candidates(filter);
+        matches = 0;
+        foreach (const DirectoryEntry *entry, candidates) {
+            if (entry->searchKey().contains(filter)) {
+                matches++;
+            }
+        }
+    }
+    QVERIFY(matches > 0);
+
+    qDeleteAll(entries);
+}
@@ -0,0 +1,139 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QtTest/QtTest>
+#include <QColor>
+#include <QIcon>
+#include <QImage>
+#include <QPainter>
+#include <QPixmap>
+
+#include <xletlib/icon_cache.h>
+
+#include "test_icon_cache.h"
+
+namespace {
+
+const int nb_rows = 5000;
+const int visible_rows = 30;
+const QSize dot_size(8, 8);
+
+QColor rowColor(int row)
+{
+    static const QColor colors[] = {QColor("#9BC920"), QColor("#E77D39"), QColor("#B24A4A")};
+    return colors[row % 3];
+}
+
+}
+
+void TestIconCache::initTestCase()
+{
+    QVERIFY(m_dir.isValid());
+    QImage dot(32, 32, QImage::Format_ARGB32_Premultiplied);
+    dot.fill(Qt::transparent);
+    QPainter painter(&dot);
+    painter.setBrush(Qt::white);
+    painter.drawEllipse(dot.rect());
+    painter.end();
+    m_dot = m_dir.path() + "/dot.png";
+    QVERIFY(dot.save(m_dot));
+}
+
+void TestIconCache::init()
+{
+    IconCache::clear();
+}
+
+void TestIconCache::testReusesPixmap()
+{
+    QPixmap first = IconCache::pixmap(m_dot, dot_size, QColor("red"));
+    QPixmap second = IconCache::pixmap(m_dot, dot_size, QColor("red"));
+
+    QCOMPARE(IconCache::count(), 1);
+    QCOMPARE(first.cacheKey(), second.cacheKey());
+    QCOMPARE(first.size(), dot_size);
+    QCOMPARE(QColor(first.toImage().pixel(4, 4)), QColor("red"));
+}
+
+void TestIconCache::testKeys()
+{
+    IconCache::pixmap(m_dot, dot_size, QColor("red"));
+    IconCache::pixmap(m_dot, dot_size, QColor("blue"));
+    IconCache::pixmap(m_dot, dot_size);
+    IconCache::pixmap(m_dot, QSize(12, 12), QColor("red"));
+
+    QCOMPARE(IconCache::count(), 4);
+}
+
+void TestIconCache::testDevicePixelRatio()
+{
+    QPixmap pixmap = IconCache::pixmap(m_dot, dot_size, QColor(), 2.0);
+
+    QCOMPARE(pixmap.size(), dot_size * 2);
+    QCOMPARE(pixmap.devicePixelRatio(), 2.0);
+}
+
+/*! \brief paint the dot column of a People table scrolled from top to bottom
+ *
+ * As PeopleEntryDotDelegate did before the cache: load, rasterize and
+ * tint the icon for each painted cell.
+ */
+void TestIconCache::benchmarkScrollUncached()
+{
+    QImage viewport(100, visible_rows * 10, QImage::Format_ARGB32_Premultiplied);
+
+    QBENCHMARK {
+        for (int first_row = 0; first_row + visible_rows <= nb_rows; first_row += visible_rows) {
+            QPainter painter(&viewport);
+            for (int row = first_row; row < first_row + visible_rows; ++row) {
+                QPixmap tinted_image = QIcon(m_dot).pixmap(dot_size);
+                QPainter tint_painter(&tinted_image);
+                tint_painter.setCompositionMode(QPainter::CompositionMode_SourceAtop);
+                tint_painter.fillRect(tinted_image.rect(), rowColor(row));
+                tint_painter.end();
+                painter.drawPixmap(0, (row - first_row) * 10, tinted_image);
+            }
+        }
+    }
+}
+
+void TestIconCache::benchmarkScrollCached()
+{
+    QImage viewport(100, visible_rows * 10, QImage::Format_ARGB32_Premultiplied);
+
+    QBENCHMARK {
+        for (int first_row = 0; first_row + visible_rows <= nb_rows; first_row += visible_rows) {
+            QPainter painter(&viewport);
+            for (int row = first_row; row < first_row + visible_rows; ++row) {
+                QPixmap tinted_image = IconCache::pixmap(m_dot, dot_size, rowColor(row), &painter);
+                painter.drawPixmap(0, (row - first_row) * 10, tinted_image);
+            }
+        }
+    }
+}
@@ -27,18 +27,29 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
+#include <QGuiApplication>
 #include <QtTest/QtTest>
 #include <gmock/gmock.h>
 
+#include <test_directory_search_index.h>
+#include <test_icon_cache.h>
 #include <test_line_directory_entry.h>
 
 int main (int argc, char *argv[])
 {
     ::testing::GTEST_FLAG(throw_on_failure) = true;
     ::testing::InitGoogleMock(&argc, argv);
+    // pixmaps need a gui application
+    QGuiApplication app(argc, argv);
 
     TestLineDirectoryEntry test_line_directory_entry;
     QTest::qExec(&test_line_directory_entry, argc, argv);
 
+    TestDirectorySearchIndex test_directory_search_index;
+    QTest::qExec(&test_directory_search_index, argc, argv);
+
+    TestIconCache test_icon_cache;
+    QTest::qExec(&test_icon_cache, argc, argv);
+
     return 0;
 }
@@ -21,5 +21,11 @@ HEADERS += $${ROOT_DIR}/src/xletlib/line_directory_entry.h
 SOURCES += $${ROOT_DIR}/src/xletlib/taintedpixmap.cpp
 HEADERS += $${ROOT_DIR}/src/xletlib/taintedpixmap.h
 
+SOURCES += $${ROOT_DIR}/src/xletlib/icon_cache.cpp
+HEADERS += $${ROOT_DIR}/src/xletlib/icon_cache.h
+
 SOURCES += $${ROOT_DIR}/src/xletlib/directory_entry.cpp
 HEADERS += $${ROOT_DIR}/src/xletlib/directory_entry.h
+
+SOURCES += $${ROOT_DIR}/src/xletlib/directory_search_index.cpp
+HEADERS += $${ROOT_DIR}/src/xletlib/directory_search_index.h
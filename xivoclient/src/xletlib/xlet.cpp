@@ -35,13 +35,19 @@ XLet::XLet(QWidget *parent, const QString &title, const QString &icon_path)
     : QWidget(parent),
       m_ui(NULL),
       m_title(title),
-      m_icon_path(icon_path)
+      m_icon_path(icon_path),
+      m_suspended(false)
 {
     connect(this, SIGNAL(ipbxCommand(const QVariantMap &)),
             b_engine, SLOT(ipbxCommand(const QVariantMap &)));
     connect(b_engine, SIGNAL(localUserInfoDefined()),
             this, SLOT(localUserInfoDefined()));
     m_xuserid = b_engine->getFullId();
+    // xlets spawned after login missed localUserInfoDefined
+    m_ui = b_engine->getXivoClientUser();
+
+    // xlets created in a hidden tab or dock never get a hide event
+    QTimer::singleShot(0, this, SLOT(suspendIfHidden()));
 }
 
 void XLet::localUserInfoDefined()
@@ -59,6 +65,52 @@ const QString & XLet::iconPath() const
     return m_icon_path;
 }
 
+void XLet::showEvent(QShowEvent *event)
+{
+    QWidget::showEvent(event);
+    if (! m_suspended) {
+        return;
+    }
+
+    m_suspended = false;
+    foreach (QTimer *timer, m_suspended_timers) {
+        if (timer) {
+            timer->start();
+        }
+    }
+    m_suspended_timers.clear();
+    this->resumed();
+}
+
+void XLet::hideEvent(QHideEvent *event)
+{
+    QWidget::hideEvent(event);
+    this->suspend();
+}
+
+void XLet::suspendIfHidden()
+{
+    if (! this->isVisible()) {
+        this->suspend();
+    }
+}
+
+void XLet::suspend()
+{
+    if (m_suspended) {
+        return;
+    }
+
+    m_suspended = true;
+    foreach (QTimer *timer, this->findChildren<QTimer *>()) {
+        if (timer->isActive() && ! timer->isSingleShot()) {
+            timer->stop();
+            m_suspended_timers.append(timer);
+        }
+    }
+    this->suspended();
+}
+
 void XLet::paintEvent(QPaintEvent *)
 {
     QStyleOption opt;
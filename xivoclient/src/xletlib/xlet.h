@@ -30,6 +30,8 @@
 #ifndef __XLET_H__
 #define __XLET_H__
 
+#include <QList>
+#include <QPointer>
 #include <QVariantMap>
 #include <QtWidgets>
 #include <QtPlugin>
@@ -47,6 +49,12 @@
  *
  * doGUIConnects() can be superclassed for xlet needing to connect
  * signal/slots from the MainWidget class.
+ *
+ * The repeating QTimer children of a hidden XLet (in another tab, a
+ * closed dock) are stopped until it is shown again. Reimplement
+ * suspended() to stop what they do not cover, such as startTimer()
+ * timers, and resumed() to restart it and catch up with what the timers
+ * would have done meanwhile.
  */
 class XLETLIB_EXPORT XLet : public QWidget
 {
@@ -78,11 +86,22 @@ class XLETLIB_EXPORT XLet : public QWidget
     public slots:
         void localUserInfoDefined();
     protected:
+        void showEvent(QShowEvent *event);
+        void hideEvent(QHideEvent *event);
+        virtual void suspended() {};  //!< called when hidden, after the child timers were stopped
+        virtual void resumed() {};  //!< called when shown again after being suspended
+
         QString m_xuserid;
         const UserInfo * m_ui;
+    private slots:
+        void suspendIfHidden();
     private:
+        void suspend();
+
         QString m_title;
         QString m_icon_path;
+        bool m_suspended;
+        QList< QPointer<QTimer> > m_suspended_timers;  //!< timers stopped while hidden
 };
 
 #endif
@@ -30,6 +30,7 @@
 #ifndef __XLETINTERFACE_H__
 #define __XLETINTERFACE_H__
 
+#include <QString>
 #include <QtPlugin>
 
 class QWidget;
@@ -42,6 +43,6 @@ class XLetInterface
         virtual XLet* newXLetInstance(QWidget *) = 0;
 };
 
-Q_DECLARE_INTERFACE(XLetInterface, "com.avencall.Plugin.XLetInterface/1.2");
+Q_DECLARE_INTERFACE(XLetInterface, "com.avencall.Plugin.XLetInterface/1.3");
 
 #endif
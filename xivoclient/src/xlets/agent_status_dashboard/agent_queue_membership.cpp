@@ -0,0 +1,175 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <baseengine.h>
+#include <storage/agentinfo.h>
+#include <xletlib/agents_model.h>
+
+#include "agent_queue_membership.h"
+#include "queue_agents_proxy_model.h"
+
+AgentQueueMembership::AgentQueueMembership(AgentsModel *model, QObject *parent)
+    : QObject(parent), m_model(model)
+{
+    connect(m_model, SIGNAL(dataChanged(const QModelIndex &, const QModelIndex &)),
+            this, SLOT(sourceDataChanged(const QModelIndex &, const QModelIndex &)));
+    connect(m_model, SIGNAL(rowsInserted(const QModelIndex &, int, int)),
+            this, SLOT(sourceRowsInserted(const QModelIndex &, int, int)));
+    connect(m_model, SIGNAL(rowsAboutToBeRemoved(const QModelIndex &, int, int)),
+            this, SLOT(sourceRowsAboutToBeRemoved(const QModelIndex &, int, int)));
+    connect(m_model, SIGNAL(modelReset()),
+            this, SLOT(sourceModelReset()));
+
+    this->sourceModelReset();
+}
+
+AgentQueueMembership::~AgentQueueMembership()
+{
+}
+
+AgentsModel * AgentQueueMembership::model() const
+{
+    return m_model;
+}
+
+QStringList AgentQueueMembership::agents(const QString &queue_id) const
+{
+    return m_agents_by_queue.value(queue_id).toList();
+}
+
+void AgentQueueMembership::addProxy(QueueAgentsProxyModel *proxy)
+{
+    m_proxies.insert(proxy->queueId(), proxy);
+}
+
+void AgentQueueMembership::removeProxy(QueueAgentsProxyModel *proxy)
+{
+    if (m_proxies.value(proxy->queueId()) == proxy) {
+        m_proxies.remove(proxy->queueId());
+    }
+}
+
+void AgentQueueMembership::sourceDataChanged(const QModelIndex &top_left, const QModelIndex &bottom_right)
+{
+    for (int row = top_left.row(); row <= bottom_right.row(); row++) {
+        this->updateAgent(this->agentIdAt(row), true);
+    }
+}
+
+void AgentQueueMembership::sourceRowsInserted(const QModelIndex &, int first, int last)
+{
+    for (int row = first; row <= last; row++) {
+        this->updateAgent(this->agentIdAt(row), false);
+    }
+}
+
+void AgentQueueMembership::sourceRowsAboutToBeRemoved(const QModelIndex &, int first, int last)
+{
+    for (int row = first; row <= last; row++) {
+        this->removeAgent(this->agentIdAt(row));
+    }
+}
+
+void AgentQueueMembership::sourceModelReset()
+{
+    foreach (const QString &agent_id, m_queues_by_agent.keys()) {
+        this->removeAgent(agent_id);
+    }
+    int row_count = m_model->rowCount(QModelIndex());
+    for (int row = 0; row < row_count; row++) {
+        this->updateAgent(this->agentIdAt(row), false);
+    }
+}
+
+QString AgentQueueMembership::agentIdAt(int source_row) const
+{
+    return m_model->data(m_model->index(source_row, AgentsModel::ID)).toString();
+}
+
+QStringList AgentQueueMembership::displayedQueues(const QString &agent_id) const
+{
+    const AgentInfo *agent = b_engine->agent(agent_id);
+    if (agent == NULL || ! agent->logged()) {
+        return QStringList();
+    }
+    return agent->queue_ids();
+}
+
+/*! \brief move an agent in or out of the queue lists
+ *
+ * \param refresh repaint the agent in the lists it stays in
+ */
+void AgentQueueMembership::updateAgent(const QString &agent_id, bool refresh)
+{
+    if (agent_id.isEmpty()) {
+        return;
+    }
+
+    const QStringList &old_queues = m_queues_by_agent.value(agent_id);
+    const QStringList &new_queues = this->displayedQueues(agent_id);
+
+    foreach (const QString &queue_id, old_queues) {
+        if (new_queues.contains(queue_id)) {
+            continue;
+        }
+        m_agents_by_queue[queue_id].remove(agent_id);
+        if (QueueAgentsProxyModel *proxy = m_proxies.value(queue_id)) {
+            proxy->removeAgent(agent_id);
+        }
+    }
+    foreach (const QString &queue_id, new_queues) {
+        QueueAgentsProxyModel *proxy = m_proxies.value(queue_id);
+        if (old_queues.contains(queue_id)) {
+            if (refresh && proxy) {
+                proxy->refreshAgent(agent_id);
+            }
+            continue;
+        }
+        m_agents_by_queue[queue_id].insert(agent_id);
+        if (proxy) {
+            proxy->addAgent(agent_id);
+        }
+    }
+
+    if (new_queues.isEmpty()) {
+        m_queues_by_agent.remove(agent_id);
+    } else {
+        m_queues_by_agent[agent_id] = new_queues;
+    }
+}
+
+void AgentQueueMembership::removeAgent(const QString &agent_id)
+{
+    foreach (const QString &queue_id, m_queues_by_agent.take(agent_id)) {
+        m_agents_by_queue[queue_id].remove(agent_id);
+        if (QueueAgentsProxyModel *proxy = m_proxies.value(queue_id)) {
+            proxy->removeAgent(agent_id);
+        }
+    }
+}
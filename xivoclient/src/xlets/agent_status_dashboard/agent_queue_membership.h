@@ -0,0 +1,80 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGENT_QUEUE_MEMBERSHIP_H__
+#define __AGENT_QUEUE_MEMBERSHIP_H__
+
+#include <QHash>
+#include <QObject>
+#include <QSet>
+#include <QStringList>
+
+class AgentsModel;
+class QModelIndex;
+class QueueAgentsProxyModel;
+
+/*! \brief Which logged agents are displayed in which queue
+ *
+ * Shared by the queue lists of the dashboard. Each change of the agents
+ * model is looked at once, and only the lists of the queues the agent
+ * entered, left or is displayed in are told about it.
+ */
+class AgentQueueMembership: public QObject
+{
+    Q_OBJECT
+
+    public:
+        AgentQueueMembership(AgentsModel *model, QObject *parent = NULL);
+        ~AgentQueueMembership();
+
+        AgentsModel * model() const;
+        QStringList agents(const QString &queue_id) const;
+
+        void addProxy(QueueAgentsProxyModel *proxy);
+        void removeProxy(QueueAgentsProxyModel *proxy);
+
+    private slots:
+        void sourceDataChanged(const QModelIndex &top_left, const QModelIndex &bottom_right);
+        void sourceRowsInserted(const QModelIndex &parent, int first, int last);
+        void sourceRowsAboutToBeRemoved(const QModelIndex &parent, int first, int last);
+        void sourceModelReset();
+
+    private:
+        QString agentIdAt(int source_row) const;
+        QStringList displayedQueues(const QString &agent_id) const;
+        void updateAgent(const QString &agent_id, bool refresh);
+        void removeAgent(const QString &agent_id);
+
+        AgentsModel *m_model;
+        QHash<QString, QStringList> m_queues_by_agent;          //!< agent id -> queues it is displayed in
+        QHash<QString, QSet<QString> > m_agents_by_queue;       //!< queue id -> agents displayed in it
+        QHash<QString, QueueAgentsProxyModel *> m_proxies;      //!< queue id -> its list
+};
+
+#endif
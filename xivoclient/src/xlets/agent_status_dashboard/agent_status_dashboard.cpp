@@ -31,11 +31,12 @@
 #include <QTimer>
 
 #include <baseengine.h>
+#include <storage/queueinfo.h>
 #include <xletlib/agents_model.h>
 
+#include "agent_queue_membership.h"
 #include "agent_status_dashboard.h"
-#include "agent_status_widget_builder.h"
-#include "agent_status_widget_storage.h"
+#include "agent_tile_renderer.h"
 #include "filtered_agent_list.h"
 
 XLet* XLetAgentStatusDashboardPlugin::newXLetInstance(QWidget *parent)
@@ -44,14 +45,20 @@ XLet* XLetAgentStatusDashboardPlugin::newXLetInstance(QWidget *parent)
     return new XletAgentStatusDashboard(parent);
 }
 
+QString XLetAgentStatusDashboardPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/agent_status_dashboard_%1");
+    return XletAgentStatusDashboard::tr("Agent status dashboard");
+}
+
 XletAgentStatusDashboard::XletAgentStatusDashboard(QWidget *parent)
     : XLet(parent, tr("Agent status dashboard"))
 {
     this->m_model = new AgentsModel(this);
+    this->m_membership = new AgentQueueMembership(this->m_model, this);
 
-    this->m_widget_builder = new AgentStatusWidgetBuilder;
-    this->m_widget_storage = new AgentStatusWidgetStorage(this->m_widget_builder);
-    this->m_delegate = new AgentStatusDelegate(this->m_widget_storage);
+    this->m_tile_renderer = new AgentTileRenderer;
+    this->m_delegate = new AgentStatusDelegate(this->m_tile_renderer);
 
     // When embedding QMainWindow in a widget, setParent must be called after instantiation.
     this->m_window = new QMainWindow();
@@ -67,23 +74,35 @@ XletAgentStatusDashboard::XletAgentStatusDashboard(QWidget *parent)
     connect(b_engine, SIGNAL(delogged()),
             this, SLOT(saveState()));
 
-    connect(b_engine, SIGNAL(updateQueueConfig(const QString &)),
+    connect(b_engine, SIGNAL(updateQueueConfig(const QString &, quint32)),
             this, SLOT(updateQueueConfig(const QString &)));
 
     connect(b_engine, SIGNAL(removeQueueConfig(const QString &)),
             this, SLOT(removeQueueConfig(const QString &)));
 
+    connect(b_engine, SIGNAL(removeAgentConfig(const QString &)),
+            this, SLOT(removeAgentConfig(const QString &)));
+    connect(b_engine, SIGNAL(clearingCache()),
+            this, SLOT(clearTileLayouts()));
+
     QTimer * timer_display = new QTimer(this);
     connect(timer_display, SIGNAL(timeout()),
             m_model, SLOT(increaseAvailability()));
     timer_display->start(1000);
+
+    // queues received before the xlet was spawned
+    foreach (const QueueInfo *queue, b_engine->queues()) {
+        this->updateQueueConfig(queue->xid());
+    }
+    if (b_engine->isInitialized()) {
+        this->restoreState();
+    }
 }
 
 XletAgentStatusDashboard::~XletAgentStatusDashboard()
 {
     delete m_delegate;
-    delete m_widget_storage;
-    delete m_widget_builder;
+    delete m_tile_renderer;
 
     foreach(const QString &queue_id, m_filtered_agent_lists.keys()){
         this->destroyQueue(queue_id);
@@ -124,7 +143,7 @@ QDockWidget * XletAgentStatusDashboard::createDock(const QString & queue_id)
 FilteredAgentList * XletAgentStatusDashboard::createFilteredAgentList(const QString & queue_id)
 {
     FilteredAgentList * filtered_agent_list = new FilteredAgentList(queue_id,
-                                                                    this->m_model,
+                                                                    this->m_membership,
                                                                     this->m_delegate);
 
     this->m_filtered_agent_lists.insert(queue_id, filtered_agent_list);
@@ -137,6 +156,16 @@ void XletAgentStatusDashboard::removeQueueConfig(const QString & queue_id)
     this->destroyQueue(queue_id);
 }
 
+void XletAgentStatusDashboard::removeAgentConfig(const QString & agent_id)
+{
+    this->m_tile_renderer->forget(agent_id);
+}
+
+void XletAgentStatusDashboard::clearTileLayouts()
+{
+    this->m_tile_renderer->clear();
+}
+
 void XletAgentStatusDashboard::restoreState()
 {
     QByteArray main_window_state = b_engine->getConfig("agent_status_dashboard.main_window_state").toByteArray();
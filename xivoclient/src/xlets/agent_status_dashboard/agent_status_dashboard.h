@@ -32,10 +32,10 @@
 
 #include "agent_status_delegate.h"
 
+class AgentQueueMembership;
 class AgentsModel;
 class AgentStatusDelegate;
-class AgentStatusWidgetBuilder;
-class AgentStatusWidgetStorage;
+class AgentTileRenderer;
 class FilteredAgentList;
 class QDockWidget;
 class QMainWindow;
@@ -50,6 +50,8 @@ class XletAgentStatusDashboard : public XLet
     private slots:
         void updateQueueConfig(const QString & queue_id);
         void removeQueueConfig(const QString & queue_id);
+        void removeAgentConfig(const QString & agent_id);
+        void clearTileLayouts();
         void restoreState();
         void saveState();
 
@@ -59,9 +61,9 @@ class XletAgentStatusDashboard : public XLet
         void destroyQueue(const QString & queue_id);
 
         AgentsModel * m_model;
+        AgentQueueMembership * m_membership;
         AgentStatusDelegate * m_delegate;
-        AgentStatusWidgetBuilder * m_widget_builder;
-        AgentStatusWidgetStorage * m_widget_storage;
+        AgentTileRenderer * m_tile_renderer;
         QMainWindow * m_window;
         QHash<QString, FilteredAgentList *> m_filtered_agent_lists;
 };
@@ -70,10 +72,11 @@ class XLetAgentStatusDashboardPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletagentstatusdashboard.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletagentstatusdashboard.json")
 
     public:
         XLet *newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
 };
 
 #endif /* __AGENT_STATUS_DASHBOARD_H__ */
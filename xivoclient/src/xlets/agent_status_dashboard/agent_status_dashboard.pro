@@ -1,6 +1,5 @@
 include(../../../common-xlets.pri)
 
-FORMS += agent_status.ui
 QT += widgets
 
 HEADERS = *.h
@@ -3,21 +3,18 @@
 
 #include <QAbstractItemDelegate>
 
-class AgentStatusWidgetStorage;
+class AgentTileRenderer;
 
 class AgentStatusDelegate: public QAbstractItemDelegate
 {
-    const static int agent_name_max_length = 11;
-
  public:
-    AgentStatusDelegate(AgentStatusWidgetStorage * widget_storage);
+    AgentStatusDelegate(AgentTileRenderer * renderer);
     ~AgentStatusDelegate();
     void paint(QPainter * painter, const QStyleOptionViewItem & option, const QModelIndex & index) const;
     QSize sizeHint(const QStyleOptionViewItem & option, const QModelIndex & index) const;
 
  private:
-    QString getInitials(const QString & full_string) const;
-    AgentStatusWidgetStorage * m_widget_storage;
+    AgentTileRenderer * m_renderer;
 };
 
 #endif
@@ -0,0 +1,161 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QPainter>
+#include <QPalette>
+#include <QRegExp>
+#include <QStringList>
+
+#include "agent_tile_renderer.h"
+
+namespace {
+
+const int tile_width = 78;
+const int tile_height = 58;
+
+struct AvailabilityStyle {
+    const char *availability;
+    const char *background;
+};
+
+const AvailabilityStyle availability_styles[] = {
+    {"AgentAvailable", "#6aa84f"},
+    {"AgentInUse", "#e69138"},
+    {"AgentOnCallNonACDIncomingInternal", "#f198b7"},
+    {"AgentOnCallNonACDIncomingExternal", "#a64d79"},
+    {"AgentOnCallNonACDOutgoingInternal", "#f198b7"},
+    {"AgentOnCallNonACDOutgoingExternal", "#a64d79"},
+};
+
+const int nb_availability_styles = sizeof(availability_styles) / sizeof(availability_styles[0]);
+
+}
+
+AgentTileRenderer::AgentTileRenderer()
+    : m_text_color(QPalette().color(QPalette::WindowText)),
+      m_name_rect(0, 10, tile_width, 10),
+      m_status_label_rect(0, 24, tile_width, 10),
+      m_status_since_rect(0, 37, tile_width, 10)
+{
+    m_font.setPointSize(8);
+    this->buildAtlas();
+}
+
+AgentTileRenderer::~AgentTileRenderer()
+{
+}
+
+QSize AgentTileRenderer::tileSize() const
+{
+    return QSize(tile_width, tile_height);
+}
+
+void AgentTileRenderer::buildAtlas()
+{
+    m_atlas = QPixmap(tile_width, tile_height * nb_availability_styles);
+    m_atlas.fill(Qt::transparent);
+
+    QPainter painter(&m_atlas);
+    for (int i = 0; i < nb_availability_styles; i++) {
+        QRect tile(0, i * tile_height, tile_width, tile_height);
+        painter.fillRect(tile, QColor(availability_styles[i].background));
+        m_atlas_tiles.insert(availability_styles[i].availability, tile);
+    }
+}
+
+void AgentTileRenderer::paint(QPainter *painter, const QPoint &top_left, const AgentTile &tile)
+{
+    QHash<QString, QRect>::const_iterator background = m_atlas_tiles.constFind(tile.availability);
+    if (background != m_atlas_tiles.constEnd()) {
+        painter->drawPixmap(top_left, m_atlas, background.value());
+    }
+
+    TextLayout &layout = m_layouts[tile.agent_id];
+    if (layout.firstname != tile.firstname || layout.lastname != tile.lastname || layout.name.text.isNull()) {
+        layout.firstname = tile.firstname;
+        layout.lastname = tile.lastname;
+        this->setText(&layout.name, agentName(tile.firstname, tile.lastname), m_name_rect);
+    }
+    if (layout.status_label.text != tile.status_label) {
+        this->setText(&layout.status_label, tile.status_label, m_status_label_rect);
+    }
+    if (layout.status_since.text != tile.status_since) {
+        this->setText(&layout.status_since, tile.status_since, m_status_since_rect);
+    }
+
+    const QPointF origin(top_left);
+    painter->save();
+    painter->setFont(m_font);
+    painter->setPen(m_text_color);
+    painter->drawStaticText(origin + layout.name.position, layout.name.layout);
+    painter->drawStaticText(origin + layout.status_label.position, layout.status_label.layout);
+    painter->drawStaticText(origin + layout.status_since.position, layout.status_since.layout);
+    painter->restore();
+}
+
+/*! \brief drop the text layout of an agent that is not shown anymore */
+void AgentTileRenderer::forget(const QString &agent_id)
+{
+    m_layouts.remove(agent_id);
+}
+
+void AgentTileRenderer::clear()
+{
+    m_layouts.clear();
+}
+
+/*! \brief lay out a line of text centered in rect */
+void AgentTileRenderer::setText(TextLine *line, const QString &text, const QRect &rect) const
+{
+    line->text = text.isNull() ? QString("") : text;
+    line->layout.setText(line->text);
+    line->layout.setTextFormat(Qt::PlainText);
+    line->layout.setPerformanceHint(QStaticText::AggressiveCaching);
+    line->layout.prepare(QTransform(), m_font);
+
+    const QSizeF &size = line->layout.size();
+    line->position = QPointF(rect.x() + (rect.width() - size.width()) / 2,
+                             rect.y() + (rect.height() - size.height()) / 2);
+}
+
+QString AgentTileRenderer::agentName(const QString &firstname, const QString &lastname)
+{
+    return QString("%1 %2").arg(initials(firstname), lastname).left(agent_name_max_length);
+}
+
+QString AgentTileRenderer::initials(const QString &full_string)
+{
+    static const QRegExp separator("\\W+");
+
+    QString return_value;
+    foreach (const QString &word_alone, full_string.split(separator, QString::SkipEmptyParts)) {
+        return_value.append(word_alone.left(1)).append(".");
+    }
+    return return_value;
+}
@@ -0,0 +1,108 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGENT_TILE_RENDERER_H__
+#define __AGENT_TILE_RENDERER_H__
+
+#include <QColor>
+#include <QFont>
+#include <QHash>
+#include <QPixmap>
+#include <QPointF>
+#include <QRect>
+#include <QSize>
+#include <QStaticText>
+#include <QString>
+
+class QPainter;
+class QPoint;
+
+/*! \brief What an agent tile displays */
+struct AgentTile
+{
+    QString agent_id;
+    QString availability;       //!< object name of the availability style, e.g. AgentAvailable
+    QString firstname;
+    QString lastname;
+    QString status_label;
+    QString status_since;
+};
+
+/*! \brief Paints agent tiles directly with a QPainter
+ *
+ * The availability backgrounds are rendered once in a pixmap atlas and the
+ * text of each agent is laid out again only when it changes. One renderer
+ * is shared by every queue list of the dashboard, so an agent in many
+ * queues is laid out once.
+ */
+class AgentTileRenderer
+{
+    public:
+        AgentTileRenderer();
+        ~AgentTileRenderer();
+
+        QSize tileSize() const;
+        void paint(QPainter *painter, const QPoint &top_left, const AgentTile &tile);
+        void forget(const QString &agent_id);
+        void clear();
+
+        static QString agentName(const QString &firstname, const QString &lastname);
+
+    private:
+        struct TextLine {
+            QString text;
+            QStaticText layout;
+            QPointF position;           //!< relative to the top left of the tile
+        };
+
+        struct TextLayout {
+            QString firstname;
+            QString lastname;
+            TextLine name;
+            TextLine status_label;
+            TextLine status_since;
+        };
+
+        void buildAtlas();
+        void setText(TextLine *line, const QString &text, const QRect &rect) const;
+        static QString initials(const QString &full_string);
+
+        const static int agent_name_max_length = 11;
+
+        QFont m_font;
+        QColor m_text_color;
+        QRect m_name_rect;
+        QRect m_status_label_rect;
+        QRect m_status_since_rect;
+        QPixmap m_atlas;                            //!< one tile per availability style
+        QHash<QString, QRect> m_atlas_tiles;        //!< availability -> its tile in m_atlas
+        QHash<QString, TextLayout> m_layouts;       //!< agent id -> text of its tile
+};
+
+#endif
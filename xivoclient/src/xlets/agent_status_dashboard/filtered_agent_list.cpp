@@ -30,19 +30,18 @@
 #include <xletlib/agents_model.h>
 #include <storage/queueinfo.h>
 
-#include "agent_status_sort_filter_proxy_model.h"
 #include "filtered_agent_list.h"
+#include "queue_agents_proxy_model.h"
 
-FilteredAgentList::FilteredAgentList(const QString &queue_id, AgentsModel * model, AgentStatusDelegate * delegate)
+FilteredAgentList::FilteredAgentList(const QString &queue_id, AgentQueueMembership * membership, AgentStatusDelegate * delegate)
 {
     this->m_queue_id = queue_id;
 
-    this->m_sort_filter_proxy_model = new AgentStatusSortFilterProxyModel(this->m_queue_id, this);
-    this->m_sort_filter_proxy_model->setSourceModel(model);
+    this->m_proxy_model = new QueueAgentsProxyModel(this->m_queue_id, membership, this);
 
     QListView * agent_list_view = new QListView(this);
     agent_list_view->setObjectName("AgentListView");
-    agent_list_view->setModel(this->m_sort_filter_proxy_model);
+    agent_list_view->setModel(this->m_proxy_model);
     agent_list_view->setModelColumn(AgentsModel::AVAILABILITY);
     agent_list_view->setItemDelegate((QAbstractItemDelegate*) delegate);
     agent_list_view->setViewMode(QListView::IconMode);
@@ -29,16 +29,16 @@
 
 #include <QWidget>
 
+class AgentQueueMembership;
 class AgentStatusDelegate;
-class AgentStatusSortFilterProxyModel;
-class AgentsModel;
+class QueueAgentsProxyModel;
 class QListView;
 
 class FilteredAgentList : public QWidget
 {
     Q_OBJECT
     public:
-        FilteredAgentList(const QString &queue_id, AgentsModel * model, AgentStatusDelegate * delegate);
+        FilteredAgentList(const QString &queue_id, AgentQueueMembership * membership, AgentStatusDelegate * delegate);
         ~FilteredAgentList();
 
         QString getQueueName();
@@ -46,7 +46,7 @@ class FilteredAgentList : public QWidget
 
     private:
         QString m_queue_id;
-        AgentStatusSortFilterProxyModel * m_sort_filter_proxy_model;
+        QueueAgentsProxyModel * m_proxy_model;
 };
 
 #endif /* __FILTERED_AGENT_LIST_H__ */
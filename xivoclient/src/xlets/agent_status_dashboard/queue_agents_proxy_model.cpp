@@ -0,0 +1,162 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <xletlib/agents_model.h>
+
+#include "agent_queue_membership.h"
+#include "queue_agents_proxy_model.h"
+
+QueueAgentsProxyModel::QueueAgentsProxyModel(const QString &queue_id, AgentQueueMembership *membership, QObject *parent)
+    : QAbstractProxyModel(parent),
+      m_queue_id(queue_id),
+      m_membership(membership),
+      m_agents_model(membership->model())
+{
+    this->setSourceModel(m_agents_model);
+    foreach (const QString &agent_id, m_membership->agents(m_queue_id)) {
+        this->addAgent(agent_id);
+    }
+    m_membership->addProxy(this);
+}
+
+QueueAgentsProxyModel::~QueueAgentsProxyModel()
+{
+    m_membership->removeProxy(this);
+}
+
+const QString & QueueAgentsProxyModel::queueId() const
+{
+    return m_queue_id;
+}
+
+QModelIndex QueueAgentsProxyModel::index(int row, int column, const QModelIndex &parent) const
+{
+    if (parent.isValid() || row < 0 || row >= m_agent_ids.size() || column < 0 || column >= AgentsModel::NB_COL) {
+        return QModelIndex();
+    }
+    return this->createIndex(row, column);
+}
+
+QModelIndex QueueAgentsProxyModel::parent(const QModelIndex &) const
+{
+    return QModelIndex();
+}
+
+int QueueAgentsProxyModel::rowCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : m_agent_ids.size();
+}
+
+int QueueAgentsProxyModel::columnCount(const QModelIndex &parent) const
+{
+    return parent.isValid() ? 0 : AgentsModel::NB_COL;
+}
+
+QModelIndex QueueAgentsProxyModel::mapToSource(const QModelIndex &proxy_index) const
+{
+    if (! proxy_index.isValid() || proxy_index.row() >= m_agent_ids.size()) {
+        return QModelIndex();
+    }
+    int source_row = m_agents_model->rowOf(m_agent_ids[proxy_index.row()]);
+    return m_agents_model->index(source_row, proxy_index.column());
+}
+
+QModelIndex QueueAgentsProxyModel::mapFromSource(const QModelIndex &source_index) const
+{
+    if (! source_index.isValid()) {
+        return QModelIndex();
+    }
+    const QString &agent_id = m_agents_model->data(m_agents_model->index(source_index.row(), AgentsModel::ID)).toString();
+    int row = this->rowOf(agent_id);
+    if (row == -1) {
+        return QModelIndex();
+    }
+    return this->index(row, source_index.column());
+}
+
+void QueueAgentsProxyModel::addAgent(const QString &agent_id)
+{
+    int source_row = m_agents_model->rowOf(agent_id);
+    if (source_row == -1 || this->rowOf(agent_id) != -1) {
+        return;
+    }
+    int row = this->lowerBound(source_row);
+    this->beginInsertRows(QModelIndex(), row, row);
+    m_agent_ids.insert(row, agent_id);
+    this->endInsertRows();
+}
+
+void QueueAgentsProxyModel::removeAgent(const QString &agent_id)
+{
+    int row = this->rowOf(agent_id);
+    if (row == -1) {
+        return;
+    }
+    this->beginRemoveRows(QModelIndex(), row, row);
+    m_agent_ids.removeAt(row);
+    this->endRemoveRows();
+}
+
+void QueueAgentsProxyModel::refreshAgent(const QString &agent_id)
+{
+    int row = this->rowOf(agent_id);
+    if (row == -1) {
+        return;
+    }
+    emit dataChanged(this->index(row, 0), this->index(row, AgentsModel::NB_COL - 1));
+}
+
+/*! \brief first row whose agent comes at or after source_row in the agents model */
+int QueueAgentsProxyModel::lowerBound(int source_row) const
+{
+    int first = 0;
+    int last = m_agent_ids.size();
+    while (first < last) {
+        int middle = (first + last) / 2;
+        if (m_agents_model->rowOf(m_agent_ids[middle]) < source_row) {
+            first = middle + 1;
+        } else {
+            last = middle;
+        }
+    }
+    return first;
+}
+
+int QueueAgentsProxyModel::rowOf(const QString &agent_id) const
+{
+    int source_row = m_agents_model->rowOf(agent_id);
+    if (source_row == -1) {
+        return -1;
+    }
+    int row = this->lowerBound(source_row);
+    if (row < m_agent_ids.size() && m_agent_ids[row] == agent_id) {
+        return row;
+    }
+    return -1;
+}
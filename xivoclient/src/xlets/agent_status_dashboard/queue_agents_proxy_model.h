@@ -0,0 +1,75 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __QUEUE_AGENTS_PROXY_MODEL_H__
+#define __QUEUE_AGENTS_PROXY_MODEL_H__
+
+#include <QAbstractProxyModel>
+#include <QStringList>
+
+class AgentQueueMembership;
+class AgentsModel;
+
+/*! \brief The logged agents of one queue, in the order of the agents model
+ *
+ * Rows are inserted, removed or refreshed one agent at a time by the
+ * AgentQueueMembership instead of filtering the whole agents model.
+ */
+class QueueAgentsProxyModel: public QAbstractProxyModel
+{
+    Q_OBJECT
+
+    public:
+        QueueAgentsProxyModel(const QString &queue_id, AgentQueueMembership *membership, QObject *parent = NULL);
+        ~QueueAgentsProxyModel();
+
+        const QString & queueId() const;
+
+        QModelIndex index(int row, int column, const QModelIndex &parent = QModelIndex()) const;
+        QModelIndex parent(const QModelIndex &child) const;
+        int rowCount(const QModelIndex &parent = QModelIndex()) const;
+        int columnCount(const QModelIndex &parent = QModelIndex()) const;
+        QModelIndex mapToSource(const QModelIndex &proxy_index) const;
+        QModelIndex mapFromSource(const QModelIndex &source_index) const;
+
+        void addAgent(const QString &agent_id);
+        void removeAgent(const QString &agent_id);
+        void refreshAgent(const QString &agent_id);
+
+    private:
+        int lowerBound(int source_row) const;
+        int rowOf(const QString &agent_id) const;
+
+        QString m_queue_id;
+        AgentQueueMembership *m_membership;
+        AgentsModel *m_agents_model;
+        QStringList m_agent_ids;            //!< row -> agent id, sorted by agents model row
+};
+
+#endif
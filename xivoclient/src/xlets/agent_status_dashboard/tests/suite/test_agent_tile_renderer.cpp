@@ -0,0 +1,124 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QImage>
+#include <QPainter>
+#include <QtTest/QtTest>
+
+#include <agent_tile_renderer.h>
+
+#include "test_agent_tile_renderer.h"
+
+namespace {
+
+AgentTile tile(const QString &agent_id, const QString &availability)
+{
+    AgentTile agent_tile;
+    agent_tile.agent_id = agent_id;
+    agent_tile.availability = availability;
+    agent_tile.firstname = "Jean-Pierre";
+    agent_tile.lastname = "Jacques";
+    agent_tile.status_label = "Available";
+    agent_tile.status_since = "00:42";
+    return agent_tile;
+}
+
+}
+
+void TestAgentTileRenderer::testAgentName()
+{
+    QCOMPARE(AgentTileRenderer::agentName("Marie-Anne", "Roy"), QString("M.A. Roy"));
+    QCOMPARE(AgentTileRenderer::agentName("Bob", "Extraordinarily"), QString("B. Extraord"));
+    QCOMPARE(AgentTileRenderer::agentName("", "Smith"), QString(" Smith"));
+}
+
+void TestAgentTileRenderer::testAvailabilityBackground()
+{
+    AgentTileRenderer renderer;
+    QImage image(renderer.tileSize(), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+
+    QPainter painter(&image);
+    renderer.paint(&painter, QPoint(0, 0), tile("xivo/1", "AgentAvailable"));
+    painter.end();
+
+    QCOMPARE(QColor(image.pixel(1, 1)), QColor("#6aa84f"));
+}
+
+void TestAgentTileRenderer::testUnknownAvailability()
+{
+    AgentTileRenderer renderer;
+    QImage image(renderer.tileSize(), QImage::Format_ARGB32_Premultiplied);
+    image.fill(Qt::white);
+
+    QPainter painter(&image);
+    renderer.paint(&painter, QPoint(0, 0), tile("xivo/1", "AgentLoggedOut"));
+    painter.end();
+
+    QCOMPARE(QColor(image.pixel(1, 1)), QColor(Qt::white));
+}
+
+/*! \brief one repaint of a wall board of 40 queues of 300 agents
+ *
+ * Each agent is shown in every queue and the status since of a third of
+ * them changed since the last repaint.
+ */
+void TestAgentTileRenderer::benchmarkWallBoard()
+{
+    const int nb_queues = 40;
+    const int nb_agents = 300;
+    const char *availabilities[] = {"AgentAvailable", "AgentInUse", "AgentOnCallNonACDIncomingExternal"};
+
+    QList<AgentTile> tiles;
+    for (int i = 0; i < nb_agents; i++) {
+        tiles.append(tile(QString("xivo/%1").arg(i), availabilities[i % 3]));
+    }
+
+    AgentTileRenderer renderer;
+    QSize tile_size = renderer.tileSize();
+    int columns = 20;
+    QImage image(tile_size.width() * columns,
+                 tile_size.height() * (nb_agents / columns),
+                 QImage::Format_ARGB32_Premultiplied);
+    QPainter painter(&image);
+
+    int second = 0;
+    QBENCHMARK {
+        second++;
+        for (int i = 0; i < nb_agents; i += 3) {
+            tiles[i].status_since = QString("00:%1").arg(second % 60, 2, 10, QChar('0'));
+        }
+        for (int queue = 0; queue < nb_queues; queue++) {
+            for (int i = 0; i < nb_agents; i++) {
+                QPoint top_left((i % columns) * tile_size.width(), (i / columns) * tile_size.height());
+                renderer.paint(&painter, top_left, tiles[i]);
+            }
+        }
+    }
+}
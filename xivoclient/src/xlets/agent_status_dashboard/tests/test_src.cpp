@@ -1,4 +1,7 @@
-/* Copyright (C) 2007-2014 Avencall
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
  *
  * XiVO Client is free software: you can redistribute it and/or modify
  * it under the terms of the GNU General Public License as published by
@@ -24,20 +27,15 @@
  * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
  */
 
-#include "agent_status_widget.h"
-#include "agent_status_widget_builder.h"
+#include <QApplication>
+#include <QtTest/QtTest>
 
-AgentStatusWidgetBuilder::AgentStatusWidgetBuilder()
-{
-}
+#include <test_agent_tile_renderer.h>
 
-AgentStatusWidgetBuilder::~AgentStatusWidgetBuilder()
+int main (int argc, char *argv[])
 {
-}
+    QApplication app(argc, argv);
 
-AgentStatusWidget * AgentStatusWidgetBuilder::build()
-{
-    AgentStatusWidget * new_widget = new AgentStatusWidget();
-    this->widget_ui.setupUi(new_widget);
-    return new_widget;
+    TestAgentTileRenderer test_agent_tile_renderer;
+    return QTest::qExec(&test_agent_tile_renderer, argc, argv);
 }
@@ -0,0 +1,16 @@
+include (../../../../common-tests.pri)
+
+TARGET = test_agent_status_dashboard
+
+QT += widgets
+
+SOURCES += $${ROOT_DIR}/src/xlets/agent_status_dashboard/tests/test_src.cpp
+
+INCLUDEPATH += $${ROOT_DIR}/src/xlets/agent_status_dashboard
+INCLUDEPATH += $${ROOT_DIR}/src/xlets/agent_status_dashboard/tests/suite
+
+HEADERS += $${ROOT_DIR}/src/xlets/agent_status_dashboard/tests/suite/*.h
+SOURCES += $${ROOT_DIR}/src/xlets/agent_status_dashboard/tests/suite/*.cpp
+
+SOURCES += $${ROOT_DIR}/src/xlets/agent_status_dashboard/agent_tile_renderer.cpp
+HEADERS += $${ROOT_DIR}/src/xlets/agent_status_dashboard/agent_tile_renderer.h
@@ -0,0 +1,328 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QCoreApplication>
+#include <QIcon>
+#include <QPixmap>
+#include <QtAlgorithms>
+
+#include <baseengine.h>
+#include <storage/agentinfo.h>
+#include <storage/queue_agent_status.h>
+#include <storage/queueinfo.h>
+#include <storage/queuememberinfo.h>
+
+#include "agent_queues_model.h"
+
+AgentQueuesModel::AgentQueuesModel(QObject *parent)
+    : QAbstractTableModel(parent)
+{
+    connect(b_engine, SIGNAL(updateQueueConfig(const QString &, quint32)),
+            this, SLOT(updateQueueConfig(const QString &)));
+    connect(b_engine, SIGNAL(removeQueueConfig(const QString &)),
+            this, SLOT(removeQueueConfig(const QString &)));
+    connect(b_engine, SIGNAL(updateQueueMemberConfig(const QString &, quint32)),
+            this, SLOT(updateQueueMemberConfig(const QString &)));
+    connect(b_engine, SIGNAL(removeQueueMemberConfig(const QString &)),
+            this, SLOT(removeQueueMemberConfig(const QString &)));
+    connect(b_engine, SIGNAL(postRemoveQueueMemberConfig(const QString &)),
+            this, SLOT(postRemoveQueueMemberConfig()));
+    connect(b_engine, SIGNAL(updateAgentConfig(const QString &, quint32)),
+            this, SLOT(updateAgentConfig(const QString &)));
+
+    foreach (const QueueInfo *queue, b_engine->queues()) {
+        m_row2id.append(queue->xid());
+    }
+    m_row2id.sort();
+    for (int row = 0; row < m_row2id.size(); ++row) {
+        m_id2row[m_row2id[row]] = row;
+    }
+}
+
+int AgentQueuesModel::rowCount(const QModelIndex &) const
+{
+    return m_row2id.size();
+}
+
+int AgentQueuesModel::columnCount(const QModelIndex &) const
+{
+    return NB_COL;
+}
+
+void AgentQueuesModel::setAgent(const QString &agent_xid)
+{
+    beginResetModel();
+    m_agent_xid = agent_xid;
+    const AgentInfo *agent = b_engine->agent(agent_xid);
+    m_agent_number = agent ? agent->agentNumber() : QString();
+    m_member_statuses.clear();
+    endResetModel();
+}
+
+QString AgentQueuesModel::queueAt(int row) const
+{
+    return m_row2id.value(row);
+}
+
+void AgentQueuesModel::updateQueueConfig(const QString &queue_xid)
+{
+    int row = m_id2row.value(queue_xid, -1);
+    if (row != -1) {
+        m_member_statuses.remove(queue_xid);
+        this->refreshRow(row);
+        return;
+    }
+
+    row = qLowerBound(m_row2id.begin(), m_row2id.end(), queue_xid) - m_row2id.begin();
+    beginInsertRows(QModelIndex(), row, row);
+    m_row2id.insert(row, queue_xid);
+    for (int i = row; i < m_row2id.size(); ++i) {
+        m_id2row[m_row2id[i]] = i;
+    }
+    endInsertRows();
+}
+
+void AgentQueuesModel::removeQueueConfig(const QString &queue_xid)
+{
+    int row = m_id2row.value(queue_xid, -1);
+    if (row == -1) {
+        return;
+    }
+
+    beginRemoveRows(QModelIndex(), row, row);
+    m_row2id.removeAt(row);
+    m_id2row.remove(queue_xid);
+    m_member_statuses.remove(queue_xid);
+    for (int i = row; i < m_row2id.size(); ++i) {
+        m_id2row[m_row2id[i]] = i;
+    }
+    endRemoveRows();
+}
+
+void AgentQueuesModel::updateQueueMemberConfig(const QString &queue_member_xid)
+{
+    int row = this->rowOfQueueMember(queue_member_xid);
+    if (row != -1) {
+        m_member_statuses.remove(m_row2id[row]);
+        this->refreshRow(row);
+    }
+}
+
+void AgentQueuesModel::removeQueueMemberConfig(const QString &queue_member_xid)
+{
+    int row = this->rowOfQueueMember(queue_member_xid);
+    if (row != -1) {
+        m_removed_member_rows.append(row);
+    }
+}
+
+void AgentQueuesModel::postRemoveQueueMemberConfig()
+{
+    foreach (int row, m_removed_member_rows) {
+        if (row < m_row2id.size()) {
+            m_member_statuses.remove(m_row2id[row]);
+            this->refreshRow(row);
+        }
+    }
+    m_removed_member_rows.clear();
+}
+
+void AgentQueuesModel::updateAgentConfig(const QString &agent_xid)
+{
+    if (agent_xid != m_agent_xid) {
+        return;
+    }
+    const AgentInfo *agent = b_engine->agent(agent_xid);
+    QString agent_number = agent ? agent->agentNumber() : QString();
+    if (agent_number != m_agent_number) {
+        this->setAgent(agent_xid);
+    }
+}
+
+//! row of the queue of a member of the monitored agent, -1 for other members
+int AgentQueuesModel::rowOfQueueMember(const QString &queue_member_xid) const
+{
+    if (m_agent_number.isEmpty()) {
+        return -1;
+    }
+    const QueueMemberInfo *queue_member = b_engine->queuemember(queue_member_xid);
+    if (queue_member == NULL
+        || ! queue_member->is_agent()
+        || queue_member->agentNumber() != m_agent_number) {
+        return -1;
+    }
+    QString queue_xid = b_engine->index().queueFromName(queue_member->queueName());
+    return m_id2row.value(queue_xid, -1);
+}
+
+void AgentQueuesModel::refreshRow(int row)
+{
+    emit dataChanged(createIndex(row, 0), createIndex(row, NB_COL - 1));
+}
+
+const AgentQueuesModel::MemberStatus & AgentQueuesModel::memberStatus(const QString &queue_xid) const
+{
+    QHash<QString, MemberStatus>::iterator cached = m_member_statuses.find(queue_xid);
+    if (cached != m_member_statuses.end()) {
+        return cached.value();
+    }
+
+    MemberStatus &member_status = m_member_statuses[queue_xid];
+    member_status.shown = false;
+
+    const AgentInfo *agent = b_engine->agent(m_agent_xid);
+    const QueueInfo *queue = b_engine->queue(queue_xid);
+    if (agent == NULL || queue == NULL || queue->ipbxid() != agent->ipbxid()) {
+        return member_status;
+    }
+
+    QString queue_member_xid = b_engine->index().queueMember(m_agent_number, queue->queueName());
+    const QueueMemberInfo *queue_member = b_engine->queuemember(queue_member_xid);
+    if (queue_member == NULL && ! queue_member_xid.isEmpty()) {
+        return member_status;
+    }
+
+    QueueAgentStatus agent_status;
+    if (queue_member != NULL) {
+        agent_status.update(queue_member->membership(), queue_member->status(), queue_member->paused());
+    } else {
+        agent_status.update("", "", "");
+    }
+
+    member_status.shown = true;
+    member_status.status_color = agent_status.display_status_color();
+    member_status.status_tooltip = QString("%1\n%2\n%3")
+        .arg(agent_status.display_status_queue())
+        .arg(agent_status.display_status_logged())
+        .arg(agent_status.display_status_membership());
+    member_status.join_icon = agent_status.display_action_join();
+    member_status.paused_color = agent_status.display_status_paused_color();
+    member_status.paused_tooltip = agent_status.display_status_paused();
+    member_status.pause_icon = agent_status.display_action_pause();
+    return member_status;
+}
+
+QVariant AgentQueuesModel::data(const QModelIndex &index, int role) const
+{
+    QString queue_xid = m_row2id.value(index.row());
+    if (queue_xid.isEmpty()) {
+        return QVariant();
+    }
+
+    switch (role) {
+    case Qt::DisplayRole:
+        return this->dataDisplay(queue_xid, index.column());
+    case Qt::DecorationRole:
+        return this->dataDecoration(queue_xid, index.column());
+    case Qt::ToolTipRole:
+        return this->dataTooltip(queue_xid, index.column());
+    case Qt::TextAlignmentRole:
+        return index.column() == NAME ? int(Qt::AlignLeft | Qt::AlignVCenter) : int(Qt::AlignCenter);
+    case Qt::UserRole:
+        return queue_xid;
+    default:
+        return QVariant();
+    }
+}
+
+QVariant AgentQueuesModel::dataDisplay(const QString &queue_xid, int column) const
+{
+    if (column != NAME) {
+        return QVariant();
+    }
+    const QueueInfo *queue = b_engine->queue(queue_xid);
+    if (queue == NULL) {
+        return QVariant();
+    }
+    return QString("%1 (%2)").arg(queue->queueDisplayName()).arg(queue->queueNumber());
+}
+
+QVariant AgentQueuesModel::dataDecoration(const QString &queue_xid, int column) const
+{
+    if (column == MORE) {
+        return QIcon(":/images/add.png");
+    }
+    if (column == NAME || m_agent_xid.isEmpty()) {
+        return QVariant();
+    }
+
+    const MemberStatus &member_status = this->memberStatus(queue_xid);
+    if (! member_status.shown) {
+        return QVariant();
+    }
+
+    switch (column) {
+    case JOIN_STATUS: {
+        QPixmap square(12, 12);
+        square.fill(member_status.status_color);
+        return square;
+    }
+    case JOIN_ACTION:
+        return member_status.join_icon.isEmpty() ? QVariant() : QIcon(member_status.join_icon);
+    case PAUSE_STATUS: {
+        QPixmap square(12, 12);
+        square.fill(member_status.paused_color);
+        return square;
+    }
+    case PAUSE_ACTION:
+        return member_status.pause_icon.isEmpty() ? QVariant() : QIcon(member_status.pause_icon);
+    default:
+        return QVariant();
+    }
+}
+
+QVariant AgentQueuesModel::dataTooltip(const QString &queue_xid, int column) const
+{
+    if (column == NAME) {
+        const QueueInfo *queue = b_engine->queue(queue_xid);
+        if (queue == NULL) {
+            return QVariant();
+        }
+        QStringList tooltips;
+        tooltips << QCoreApplication::translate("XletAgentDetails", "Server: %1").arg(queue->ipbxid())
+                 << QCoreApplication::translate("XletAgentDetails", "Context: %1").arg(queue->context());
+        return tooltips.join("\n");
+    }
+    if (m_agent_xid.isEmpty()) {
+        return QVariant();
+    }
+
+    const MemberStatus &member_status = this->memberStatus(queue_xid);
+    if (! member_status.shown) {
+        return QVariant();
+    }
+    switch (column) {
+    case JOIN_STATUS:
+        return member_status.status_tooltip;
+    case PAUSE_STATUS:
+        return member_status.paused_tooltip;
+    default:
+        return QVariant();
+    }
+}
@@ -0,0 +1,105 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __AGENT_QUEUES_MODEL_H__
+#define __AGENT_QUEUES_MODEL_H__
+
+#include <QAbstractTableModel>
+#include <QColor>
+#include <QHash>
+#include <QList>
+#include <QStringList>
+
+/*! \brief Queues of the IPBX with the membership of the monitored agent
+ *
+ * One row per queue, sorted by queue xid. The status of the agent in a
+ * queue is computed when a row is painted and kept until its queue member
+ * changes, so that an update only refreshes the row of its queue.
+ */
+class AgentQueuesModel : public QAbstractTableModel
+{
+    Q_OBJECT
+
+    public:
+        AgentQueuesModel(QObject *parent = NULL);
+
+        int rowCount(const QModelIndex &) const;
+        int columnCount(const QModelIndex &) const;
+        QVariant data(const QModelIndex &, int role = Qt::DisplayRole) const;
+
+        void setAgent(const QString &agent_xid);
+        QString queueAt(int row) const;
+
+    public slots:
+        void updateQueueConfig(const QString &queue_xid);
+        void removeQueueConfig(const QString &queue_xid);
+        void updateQueueMemberConfig(const QString &queue_member_xid);
+        void removeQueueMemberConfig(const QString &queue_member_xid);
+        void postRemoveQueueMemberConfig();
+        void updateAgentConfig(const QString &agent_xid);
+
+    public:
+        enum Columns {
+            NAME,
+            MORE,
+            JOIN_STATUS,
+            JOIN_ACTION,
+            PAUSE_STATUS,
+            PAUSE_ACTION,
+            NB_COL
+        };
+
+    private:
+        //! what is shown of the agent membership in a queue
+        struct MemberStatus {
+            bool shown;
+            QColor status_color;
+            QString status_tooltip;
+            QString join_icon;
+            QColor paused_color;
+            QString paused_tooltip;
+            QString pause_icon;
+        };
+
+        const MemberStatus & memberStatus(const QString &queue_xid) const;
+        int rowOfQueueMember(const QString &queue_member_xid) const;
+        void refreshRow(int row);
+        QVariant dataDisplay(const QString &queue_xid, int column) const;
+        QVariant dataDecoration(const QString &queue_xid, int column) const;
+        QVariant dataTooltip(const QString &queue_xid, int column) const;
+
+        QString m_agent_xid;
+        QString m_agent_number;
+        QStringList m_row2id;                                //!< sorted queue xids
+        QHash<QString, int> m_id2row;                        //!< reverse of m_row2id
+        mutable QHash<QString, MemberStatus> m_member_statuses;  //!< queue xid -> cached status
+        QList<int> m_removed_member_rows;                    //!< rows to refresh once the members are deleted
+};
+
+#endif
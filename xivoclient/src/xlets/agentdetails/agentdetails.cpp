@@ -31,6 +31,8 @@
 #include <QLabel>
 #include <QPushButton>
 #include <QGridLayout>
+#include <QHeaderView>
+#include <QTableView>
 
 #include <storage/agentinfo.h>
 #include <storage/queueinfo.h>
@@ -38,6 +40,7 @@
 #include <dao/queuememberdao.h>
 
 #include "agentdetails.h"
+#include "agent_queues_model.h"
 
 XLet* XLetAgentDetailsPlugin::newXLetInstance(QWidget *parent)
 {
@@ -45,6 +48,12 @@ XLet* XLetAgentDetailsPlugin::newXLetInstance(QWidget *parent)
     return new XletAgentDetails(parent);
 }
 
+QString XLetAgentDetailsPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/agentdetails_%1");
+    return XletAgentDetails::tr("Agent Details");
+}
+
 XletAgentDetails::XletAgentDetails(QWidget *parent)
     : XLet(parent, tr("Agent Details"))
 {
@@ -92,6 +101,26 @@ XletAgentDetails::XletAgentDetails(QWidget *parent)
     m_gridlayout->addWidget(m_agentlegend_npaused, m_linenum, 5, 1, 3, Qt::AlignCenter);
     m_linenum ++;
 
+    m_queues_model = new AgentQueuesModel(this);
+    m_queues_view = new QTableView(this);
+    m_queues_view->setModel(m_queues_model);
+    m_queues_view->setShowGrid(false);
+    m_queues_view->setSelectionMode(QAbstractItemView::NoSelection);
+    m_queues_view->setEditTriggers(QAbstractItemView::NoEditTriggers);
+    m_queues_view->setIconSize(QSize(10, 10));
+    m_queues_view->horizontalHeader()->hide();
+    m_queues_view->horizontalHeader()->setSectionResizeMode(AgentQueuesModel::NAME, QHeaderView::Stretch);
+    m_queues_view->verticalHeader()->hide();
+    m_queues_view->verticalHeader()->setSectionResizeMode(QHeaderView::ResizeToContents);
+    for (int column = AgentQueuesModel::MORE; column < AgentQueuesModel::NB_COL; ++column) {
+        m_queues_view->horizontalHeader()->setSectionResizeMode(column, QHeaderView::ResizeToContents);
+    }
+    m_gridlayout->addWidget(m_queues_view, m_linenum, 0, 1, 9);
+    m_gridlayout->setRowStretch(m_linenum, 1);
+    m_queues_view->hide();
+    connect(m_queues_view, SIGNAL(clicked(const QModelIndex &)),
+            this, SLOT(queueClicked(const QModelIndex &)));
+
     m_gridlayout->setVerticalSpacing(0);
     m_agentlegend_qname->hide();
     m_agentlegend_joined->hide();
@@ -112,26 +141,14 @@ XletAgentDetails::XletAgentDetails(QWidget *parent)
     connect(timer_header, SIGNAL(timeout()), this, SLOT(updateAvailability()));
     timer_header->start(1000);
 
-    connect(b_engine, SIGNAL(updateAgentConfig(const QString &)),
-            this, SLOT(updateAgentConfig(const QString &)));
-    connect(b_engine, SIGNAL(updateAgentStatus(const QString &)),
-            this, SLOT(updateAgentStatus(const QString &)));
-    connect(b_engine, SIGNAL(updateQueueConfig(const QString &)),
-            this, SLOT(updatePanel()));
-    connect(b_engine, SIGNAL(postRemoveQueueConfig(const QString &)),
-            this, SLOT(onRemoveQueueConfig()));
-    connect(b_engine, SIGNAL(updateQueueStatus(const QString &)),
-            this, SLOT(updatePanel()));
-    connect(b_engine, SIGNAL(updateQueueMemberConfig(const QString &)),
-            this, SLOT(updatePanel()));
-    connect(b_engine, SIGNAL(postRemoveQueueMemberConfig(const QString &)),
-            this, SLOT(updatePanel()));
-
     connect(b_engine, SIGNAL(changeWatchedAgentSignal(const QString &)),
             this, SLOT(monitorThisAgent(const QString &)));
     connect(b_engine, SIGNAL(settingsChanged()),
             this, SLOT(updatePanel()));
 
+    if (! b_engine->watchedAgentId().isEmpty()) {
+        this->monitorThisAgent(b_engine->watchedAgentId());
+    }
 }
 
 void XletAgentDetails::updateAgentConfig(const QString & xagentid)
@@ -149,42 +166,18 @@ void XletAgentDetails::updateAgentStatus(const QString & xagentid)
 void XletAgentDetails::monitorThisAgent(const QString & agentid)
 {
     if (b_engine->hasAgent(agentid)) {
+        UpdateRouter &router = b_engine->updateRouter();
+        router.unsubscribe(this);
+        router.subscribe("agents", UpdateRouter::CONFIG, agentid,
+                         this, SLOT(updateAgentConfig(const QString &)));
+        router.subscribe("agents", UpdateRouter::STATUS, agentid,
+                         this, SLOT(updateAgentStatus(const QString &)));
         m_monitored_agentid = agentid;
-        clearPanel();
+        m_queues_model->setAgent(agentid);
         updatePanel();
     }
 }
 
-void XletAgentDetails::onRemoveQueueConfig()
-{
-    clearPanel();
-    updatePanel();
-}
-
-void XletAgentDetails::clearPanel()
-{
-    // qDebug() << Q_FUNC_INFO;
-    foreach (QString q, m_queue_labels.keys())
-        delete m_queue_labels[q];
-    foreach (QString q, m_queue_more.keys())
-        delete m_queue_more[q];
-    foreach (QString q, m_queue_join_status.keys())
-        delete m_queue_join_status[q];
-    foreach (QString q, m_queue_join_action.keys())
-        delete m_queue_join_action[q];
-    foreach (QString q, m_queue_pause_status.keys())
-        delete m_queue_pause_status[q];
-    foreach (QString q, m_queue_pause_action.keys())
-        delete m_queue_pause_action[q];
-
-    m_queue_labels.clear();
-    m_queue_more.clear();
-    m_queue_join_status.clear();
-    m_queue_join_action.clear();
-    m_queue_pause_status.clear();
-    m_queue_pause_action.clear();
-}
-
 void XletAgentDetails::updateHeader()
 {
     const AgentInfo * agent = b_engine->agent(m_monitored_agentid);
@@ -275,193 +268,37 @@ void XletAgentDetails::updatePanel()
         m_actionlegends[function]->show();
         m_action[function]->show();
     }
+    m_queues_view->show();
 
-    QStringList xqueueids;
     QVariantMap properties = agentinfo->properties();
     QVariant agentstats = properties["agentstats"];
     m_agentlegend_njoined->setText(agentstats.toMap().value("Xivo-NQJoined").toString());
     m_agentlegend_npaused->setText(agentstats.toMap().value("Xivo-NQPaused").toString());
-
-    QHashIterator<QString, XInfo *> iter = QHashIterator<QString, XInfo *>(b_engine->iterover("queues"));
-    while (iter.hasNext()) {
-        iter.next();
-        QString xqueueid = iter.key();
-        QueueInfo * queueinfo = (QueueInfo *) iter.value();
-        xqueueids << xqueueid;
-        bool isnewqueue = false;
-        if (! m_queue_labels.contains(xqueueid))
-            isnewqueue = true;
-
-        if (isnewqueue) {
-            m_queue_labels[xqueueid] = new QLabel(this);
-            m_queue_more[xqueueid] = new QPushButton(this);
-            m_queue_join_status[xqueueid] = new QLabel(this);
-            m_queue_join_action[xqueueid] = new QPushButton(this);
-            m_queue_pause_status[xqueueid] = new QLabel(this);
-            m_queue_pause_action[xqueueid] = new QPushButton(this);
-            m_queue_join_status[xqueueid]->setProperty("Status", "undefined");
-            m_queue_pause_status[xqueueid]->setProperty("Paused", "undefined");
-
-            m_queue_join_status[xqueueid]->hide();
-            m_queue_join_action[xqueueid]->hide();
-            m_queue_pause_status[xqueueid]->hide();
-            m_queue_pause_action[xqueueid]->hide();
-        }
-
-        setQueueLookProps(xqueueid);
-        setQueueProps(xqueueid);
-        if (queueinfo->ipbxid() == agentinfo->ipbxid()) {
-            QString refmember = QueueMemberDAO::queueMemberId(agentinfo->xid(), queueinfo->xid());
-            setQueueAgentProps(xqueueid, refmember);
-        }
-
-        if (isnewqueue)
-            setQueueAgentSignals(xqueueid);
-    }
-
-    xqueueids.sort();
-    int i = 0;
-    foreach (QString xqueueid, xqueueids) {
-        fillQueue(i, xqueueid);
-        i ++;
-    }
-}
-
-void XletAgentDetails::setQueueLookProps(const QString & xqueueid)
-{
-    m_queue_more[xqueueid]->setIconSize(QSize(10, 10));
-    m_queue_join_action[xqueueid]->setIconSize(QSize(8, 8));
-    m_queue_pause_action[xqueueid]->setIconSize(QSize(8, 8));
-    m_queue_more[xqueueid]->setIcon(QIcon(":/images/add.png"));
-}
-
-void XletAgentDetails::setQueueProps(const QString & xqueueid)
-{
-    const QueueInfo * queueinfo = b_engine->queue(xqueueid);
-    if (queueinfo == NULL)
-        return;
-
-    m_queue_labels[xqueueid]->setText(getQueueLabelText(xqueueid));
-    QStringList tooltips;
-    tooltips << tr("Server: %1").arg(queueinfo->ipbxid())
-             << tr("Context: %1").arg(queueinfo->context());
-    m_queue_labels[xqueueid]->setToolTip(tooltips.join("\n"));
-}
-
-QString XletAgentDetails::getQueueLabelText(const QString & queue_xid)
-{
-    const QueueInfo * queueinfo = b_engine->queue(queue_xid);
-    if (queueinfo == NULL) {
-        return QString();
-    }
-
-    QString display_name = queueinfo->queueDisplayName();
-    display_name += QString(" (%1)").arg(queueinfo->queueNumber());
-    return display_name;
-}
-
-void XletAgentDetails::setQueueAgentSignals(const QString & xqueueid)
-{
-    m_queue_more[xqueueid]->setProperty("xqueueid", xqueueid);
-    m_queue_more[xqueueid]->setProperty("action", "changequeue");
-
-    connect( m_queue_more[xqueueid], SIGNAL(clicked()),
-             this, SLOT(queueClicked()));
-    if (! b_engine->getConfig("guioptions.xlet.agentdetails.noqueueaction").toBool()) {
-        connect( m_queue_join_action[xqueueid], SIGNAL(clicked()),
-                 this, SLOT(queueClicked()));
-        connect( m_queue_pause_action[xqueueid], SIGNAL(clicked()),
-                 this, SLOT(queueClicked()));
-    }
-}
-
-void XletAgentDetails::setQueueAgentProps(const QString & xqueueid, const QString & xqueuemember)
-{
-    const QueueMemberInfo * qmi = b_engine->queuemember(xqueuemember);
-    if ((qmi == NULL) && (! xqueuemember.isEmpty()))
-        return;
-    m_queue_join_action[xqueueid]->setProperty("xqueueid", xqueueid);
-    m_queue_join_action[xqueueid]->setProperty("action", "leavejoin");
-    m_queue_pause_action[xqueueid]->setProperty("xqueueid", xqueueid);
-    m_queue_pause_action[xqueueid]->setProperty("action", "pause");
-    m_queue_join_status[xqueueid]->show();
-    m_queue_pause_status[xqueueid]->show();
-
-    QString oldstatus = m_queue_join_status[xqueueid]->property("Status").toString();
-    QString oldpaused = m_queue_pause_status[xqueueid]->property("Paused").toString();
-
-    QString status = "";
-    QString paused = "";
-    QString membership = "";
-
-    if (qmi != NULL) {
-        status = qmi->status();
-        paused = qmi->paused();
-        membership = qmi->membership();
-    }
-
-    QueueAgentStatus * qas = new QueueAgentStatus();
-    qas->update(membership, status, paused);
-
-    QString joinicon = qas->display_action_join();
-    if (joinicon.isEmpty()) {
-        m_queue_join_action[xqueueid]->hide();
-    } else {
-        m_queue_join_action[xqueueid]->setIcon(QIcon(joinicon));
-        m_queue_join_action[xqueueid]->show();
-    }
-
-    if (status != oldstatus) {
-        QPixmap square(12, 12);
-        square.fill(qas->display_status_color());
-        m_queue_join_status[xqueueid]->setPixmap(square);
-        m_queue_join_status[xqueueid]->setToolTip(QString("%1\n%2\n%3")
-                                                 .arg(qas->display_status_queue())
-                                                 .arg(qas->display_status_logged())
-                                                 .arg(qas->display_status_membership()));
-        m_queue_join_status[xqueueid]->setProperty("Status", status);
-    }
-
-    if (paused != oldpaused) {
-        QString pauseicon = qas->display_action_pause();
-        if (pauseicon.isEmpty()) {
-            m_queue_pause_action[xqueueid]->hide();
-        } else {
-            m_queue_pause_action[xqueueid]->setIcon(QIcon(pauseicon));
-            m_queue_pause_action[xqueueid]->show();
-        }
-        m_queue_pause_status[xqueueid]->setToolTip(qas->display_status_paused());
-        QPixmap square(12, 12);
-        square.fill(qas->display_status_paused_color());
-        m_queue_pause_status[xqueueid]->setPixmap(square);
-        m_queue_pause_status[xqueueid]->setProperty("Paused", paused);
-    }
-
-    delete qas;
-}
-
-void XletAgentDetails::fillQueue(int ii, const QString & xqueueid)
-{
-    m_gridlayout->addWidget( m_queue_labels[xqueueid], ii + m_linenum, 0, Qt::AlignLeft );
-    m_gridlayout->addWidget( m_queue_more[xqueueid], ii + m_linenum, 1, Qt::AlignCenter );
-    m_gridlayout->addWidget( m_queue_join_status[xqueueid], ii + m_linenum, 2, Qt::AlignCenter );
-    m_gridlayout->addWidget( m_queue_join_action[xqueueid], ii + m_linenum, 3, Qt::AlignCenter );
-    m_gridlayout->addWidget( m_queue_pause_status[xqueueid], ii + m_linenum, 5, Qt::AlignCenter );
-    m_gridlayout->addWidget( m_queue_pause_action[xqueueid], ii + m_linenum, 6, Qt::AlignCenter );
 }
 
 /*! \brief execute action on queue
  *
- * supports actions "changequeue", "leavejoin", "pause"
+ * supports actions "changequeue", "leavejoin", "pause" from the columns
+ * of the queue table
  */
-void XletAgentDetails::queueClicked()
+void XletAgentDetails::queueClicked(const QModelIndex &index)
 {
-    QString xqueueid = sender()->property("xqueueid").toString();
+    QString xqueueid = m_queues_model->queueAt(index.row());
     const QueueInfo * queueinfo = b_engine->queue(xqueueid);
     if (queueinfo == NULL)
         return;
-    QString action  = sender()->property("action").toString();
-    QString queuename = queueinfo->queueName();
+
+    QString action;
+    bool queue_actions = ! b_engine->getConfig("guioptions.xlet.agentdetails.noqueueaction").toBool();
+    if (index.column() == AgentQueuesModel::MORE) {
+        action = "changequeue";
+    } else if (index.column() == AgentQueuesModel::JOIN_ACTION && queue_actions) {
+        action = "leavejoin";
+    } else if (index.column() == AgentQueuesModel::PAUSE_ACTION && queue_actions) {
+        action = "pause";
+    } else {
+        return;
+    }
 
     QString xqueuemember = QueueMemberDAO::queueMemberId(m_monitored_agentid, xqueueid);
     const QueueMemberInfo * qmi = b_engine->queuemember(xqueuemember);
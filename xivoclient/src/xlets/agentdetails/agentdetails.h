@@ -38,7 +38,10 @@
 
 class QGridLayout;
 class QLabel;
+class QModelIndex;
 class QPushButton;
+class QTableView;
+class AgentQueuesModel;
 
 /*! \brief Display details about an agent
  */
@@ -58,22 +61,13 @@ class XletAgentDetails : public XLet
         void monitorThisAgent(const QString &);
 
     private slots:
-        void queueClicked();
+        void queueClicked(const QModelIndex &);
         void actionClicked();
         void updatePanel();
-        void onRemoveQueueConfig();
         void updateHeader();
         void updateAvailability();
 
     private:
-        void clearPanel();
-        void setQueueLookProps(const QString &);
-        void setQueueAgentProps(const QString &, const QString &);
-        void setQueueProps(const QString &);
-        void setQueueAgentSignals(const QString &);
-        void fillQueue(int, const QString &);
-        QString getQueueLabelText(const QString &);
-
         QGridLayout *m_gridlayout; //!< layout
         int m_linenum;  //!< line number ?
 
@@ -88,12 +82,8 @@ class XletAgentDetails : public XLet
         QHash<QString, QLabel *> m_actionlegends;   //!< Label Login/Logout
         QHash<QString, QPushButton *> m_action; //!< buttons cancel/ok
 
-        QHash<QString, QLabel *> m_queue_labels;
-        QHash<QString, QPushButton *> m_queue_more;
-        QHash<QString, QPushButton *> m_queue_join_action;
-        QHash<QString, QPushButton *> m_queue_pause_action;
-        QHash<QString, QLabel *> m_queue_join_status;
-        QHash<QString, QLabel *> m_queue_pause_status;
+        AgentQueuesModel *m_queues_model;  //!< queues and membership of the agent
+        QTableView *m_queues_view;
 
         QPoint m_eventpoint;
 };
@@ -102,10 +92,11 @@ class XLetAgentDetailsPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletagentdetails.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletagentdetails.json")
 
     public:
         XLet *newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
 };
 
 #endif /* __AGENTDETAILSPANEL_H__ */
@@ -42,6 +42,12 @@ XLet* XLetAgentsPlugin::newXLetInstance(QWidget *parent)
     return new XletAgents(parent);
 }
 
+QString XLetAgentsPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/agents_%1");
+    return XletAgents::tr("Agents' List (plain)");
+}
+
 XletAgents::XletAgents(QWidget *parent)
     : XLet(parent, tr("Agents' List (plain)"))
 {
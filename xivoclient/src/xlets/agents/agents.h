@@ -49,10 +49,11 @@ class XLetAgentsPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletagents.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletagents.json")
 
     public:
         XLet *newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
 };
 
 #endif /* __AGENTSPANEL_H__ */
@@ -166,3 +166,14 @@ XLet* XLetConferencePlugin::newXLetInstance(QWidget *parent)
     b_engine->registerTranslation(":/obj/conference_%1");
     return new Conference(parent);
 }
+
+QString XLetConferencePlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/conference_%1");
+    return Conference::tr("Conference");
+}
+
+QString XLetConferencePlugin::xletIconPath()
+{
+    return ":/images/tab-conference.svg";
+}
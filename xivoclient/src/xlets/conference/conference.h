@@ -86,10 +86,12 @@ class XLetConferencePlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletconference.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletconference.json")
 
     public:
         XLet *newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
+        QString xletIconPath();
 };
 
 #endif
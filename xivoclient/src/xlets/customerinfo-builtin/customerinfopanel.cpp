@@ -110,7 +110,7 @@ void CustomerInfoPanel::displayFiche(const QString & fichecontent, bool qtui, co
 
     // Get Data and Popup the profile if ok
     if (popup == NULL) {
-        popup = new Popup(m_autourl_allowed);
+        popup = new Popup(m_autourl_allowed, &m_form_cache);
         m_popups.append(popup);
         popup->setId(id);
         connect(popup, SIGNAL(destroyed(QObject *)),
@@ -46,6 +46,7 @@
 #include <baseengine.h>
 
 #include "popup.h"
+#include "sheet_form_cache.h"
 
 class Popup;
 
@@ -76,6 +77,7 @@ class CustomerInfoPanel : public XLet
         QList<Popup *> m_popups;
         quint32 m_tablimit;
         bool m_autourl_allowed;
+        SheetFormCache m_form_cache;
 
     FUNCTESTED
 };
@@ -37,7 +37,6 @@
 #include <QPixmap>
 #include <QPushButton>
 #include <QSettings>
-#include <QUiLoader>
 #include <QUrl>
 #include <QVariant>
 #include <QHBoxLayout>
@@ -51,13 +50,9 @@
 #include "phonenumber.h"
 #include "popup.h"
 #include "form_result_extractor.h"
+#include "sheet_form_cache.h"
 
-
-QStringList g_formbuttonnames = (QStringList()
-                                 << "refuse" << "hangup" << "answer"
-                                 << "close" << "save");
-
-Popup::Popup(const bool urlautoallow, QWidget *parent)
+Popup::Popup(const bool urlautoallow, SheetFormCache *form_cache, QWidget *parent)
     : QWidget(parent),
       m_inputstream(NULL),
       m_buffer(NULL),
@@ -78,7 +73,7 @@ Popup::Popup(const bool urlautoallow, QWidget *parent)
       m_sheetui(false),
       m_firstline(3),
       m_sheetui_widget(NULL),
-      m_uiloader(NULL),
+      m_form_cache(form_cache),
       m_nfeeds(0)
 {
 }
@@ -89,7 +84,6 @@ Popup::~Popup()
     delete m_handler;
     delete m_reader;
     delete m_sheetui_widget;
-    delete m_uiloader;
 }
 
 /*!
@@ -101,9 +95,15 @@ void Popup::feed(QIODevice * inputstream,
     m_nfeeds ++;
     m_inputstream = inputstream;
 
+    // the handler and the reader are kept across feeds, only the source changes
+    delete m_xmlInputSource;
     m_xmlInputSource = new QXmlInputSource(m_inputstream);
-    m_handler = new XmlHandler(this);
-    m_reader = new QXmlSimpleReader();
+    if (m_reader == NULL) {
+        m_handler = new XmlHandler(this);
+        m_reader = new QXmlSimpleReader();
+        m_reader->setContentHandler(m_handler);
+        m_reader->setErrorHandler(m_handler);
+    }
 
     m_sheetui = sheetui;
 
@@ -111,8 +111,6 @@ void Popup::feed(QIODevice * inputstream,
     QString currentDateTimeStr = currentDateTime.toString(Qt::LocalDate);
     qDebug() << Q_FUNC_INFO << this << m_nfeeds << inputstream << currentDateTime << sheetui << m_handler;
 
-    m_reader->setContentHandler(m_handler);
-    m_reader->setErrorHandler(m_handler);
     m_parsingStarted = false;
 
     if(m_nfeeds == 1) {
@@ -141,18 +139,19 @@ void Popup::feed(QIODevice * inputstream,
         m_vlayout->addStretch();
     }
 
-    m_uiloader = new QUiLoader();
     if(sheetui) {
-        m_sheetui_widget = m_uiloader->load(m_inputstream, this);
-        m_vlayout->insertWidget(m_vlayout->count() - 1, m_sheetui_widget, 0, 0);
-        foreach(QString formbuttonname, g_formbuttonnames) {
-            m_form_buttons[formbuttonname] = m_sheetui_widget->findChild<QPushButton *>(formbuttonname);
-            if(m_form_buttons[formbuttonname]) {
-                m_form_buttons[formbuttonname]->setProperty("buttonname", formbuttonname);
-                connect( m_form_buttons[formbuttonname], SIGNAL(clicked()),
-                         this, SLOT(actionFromForm()) );
-            }
+        bool was_open = m_inputstream->isOpen();
+        if (! was_open) {
+            m_inputstream->open(QIODevice::ReadOnly);
         }
+        QByteArray ui_content = m_inputstream->readAll();
+        if (! was_open) {
+            m_inputstream->close();
+        }
+        SheetFormCache::Form form = m_form_cache->takeForm("sheetui", ui_content, this);
+        m_sheetui_widget = form.widget;
+        m_vlayout->insertWidget(m_vlayout->count() - 1, m_sheetui_widget, 0, 0);
+        bindFormButtons(form.button_names);
         setEnablesOnForms();
 
         QLineEdit   * datetime = m_sheetui_widget->findChild<QLineEdit *>("datetime");
@@ -285,18 +284,14 @@ void Popup::addDefForm(const QString & name, const QString & value)
 
 void Popup::addInfoForm(int where, const QString & value)
 {
-    QUiLoader loader;
+    QByteArray ui_content;
     if(m_remoteforms.contains(value)) {
-        m_buffer = new QBuffer(this);
-        m_buffer->open(QIODevice::ReadWrite);
-        m_buffer->write(m_remoteforms[value].toUtf8());
-        m_buffer->close();
-        m_sheetui_widget = loader.load(m_buffer, this);
+        ui_content = m_remoteforms[value].toUtf8();
     } else {
         QFile file(value);
         if (file.exists()) {
             file.open(QFile::ReadOnly);
-            m_sheetui_widget = loader.load(&file, this);
+            ui_content = file.readAll();
             file.close();
         } else {
             qDebug() << Q_FUNC_INFO << "file does not exist" << value;
@@ -304,30 +299,37 @@ void Popup::addInfoForm(int where, const QString & value)
         }
     }
 
-    foreach(QString formbuttonname, g_formbuttonnames) {
-        if(! m_form_buttons[formbuttonname]) {
-            m_form_buttons[formbuttonname] = m_sheetui_widget->findChild<QPushButton *>(formbuttonname);
-            if(m_form_buttons[formbuttonname]) {
-                m_form_buttons[formbuttonname]->setProperty("buttonname", formbuttonname);
-                connect( m_form_buttons[formbuttonname], SIGNAL(clicked()),
-                         this, SLOT(actionFromForm()) );
-            }
-        } else {
-            qDebug() << Q_FUNC_INFO << "already ?" << formbuttonname << m_sheetui_widget->findChild<QPushButton *>(formbuttonname);
-        }
-    }
+    SheetFormCache::Form form = m_form_cache->takeForm(value, ui_content, this);
+    m_sheetui_widget = form.widget;
+    if(m_sheetui_widget == NULL)
+        return;
+
+    bindFormButtons(form.button_names);
+    setEnablesOnForms();
+    m_vlayout->insertWidget(where, m_sheetui_widget);
+}
 
-    QRegExp re_callstatus("^XIVO_CALL_STATUS-");
-    foreach(QPushButton * callstatusbutton, m_sheetui_widget->findChildren<QPushButton *>(re_callstatus)) {
-        QString formbuttonname = callstatusbutton->objectName();
-        m_form_buttons[formbuttonname] = callstatusbutton;
-        m_form_buttons[formbuttonname]->setProperty("buttonname", formbuttonname);
-        connect( m_form_buttons[formbuttonname], SIGNAL(clicked()),
+/*! \brief connect the buttons of the current form to actionFromForm()
+ *
+ * The first form to provide a standard button keeps it, call status
+ * buttons are always taken from the latest form.
+ */
+void Popup::bindFormButtons(const QStringList & button_names)
+{
+    foreach(const QString & formbuttonname, button_names) {
+        bool call_status = formbuttonname.startsWith("XIVO_CALL_STATUS-");
+        if(! call_status && m_form_buttons.value(formbuttonname)) {
+            qDebug() << Q_FUNC_INFO << "already ?" << formbuttonname;
+            continue;
+        }
+        QPushButton * button = m_sheetui_widget->findChild<QPushButton *>(formbuttonname);
+        if(button == NULL)
+            continue;
+        m_form_buttons[formbuttonname] = button;
+        button->setProperty("buttonname", formbuttonname);
+        connect( button, SIGNAL(clicked()),
                  this, SLOT(actionFromForm()) );
     }
-    setEnablesOnForms();
-    if(m_sheetui_widget != NULL)
-        m_vlayout->insertWidget(where, m_sheetui_widget);
 }
 
 void Popup::addInfoText(int where, const QString & name, const QString & value)
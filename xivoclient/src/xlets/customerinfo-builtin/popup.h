@@ -46,17 +46,17 @@ class QXmlSimpleReader;
 class QIODevice;
 class QVBoxLayout;
 class QHBoxLayout;
-class QUiLoader;
 
 class UserInfo;
 class BaseEngine;
+class SheetFormCache;
 
 class Popup: public QWidget
 {
     Q_OBJECT
 
     public:
-        Popup(const bool , QWidget *parent=0);
+        Popup(const bool, SheetFormCache *, QWidget *parent=0);
         ~Popup();
         void feed(QIODevice *, const bool &);
         void addInfoInternal(const QString &, const QString &);  //! Add a Text field (name, value)
@@ -103,6 +103,7 @@ class Popup: public QWidget
 
     private:
         void addInfoForm(int, const QString &);
+        void bindFormButtons(const QStringList &);
         void sendFormResult();
         void setEnablesOnForms();
 
@@ -133,7 +134,7 @@ class Popup: public QWidget
         bool m_sheetui;
         int m_firstline;
         QWidget * m_sheetui_widget;
-        QUiLoader * m_uiloader;
+        SheetFormCache * m_form_cache;  //!< loaded forms, shared by all popups
         QStringList m_orders;
         QList<QStringList> m_sheetlines;
         QHash<QString, QPushButton *> m_form_buttons;
@@ -0,0 +1,139 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include <QBuffer>
+#include <QCryptographicHash>
+#include <QPushButton>
+#include <QRegExp>
+#include <QTimer>
+#include <QWidget>
+
+#include "sheet_form_cache.h"
+
+namespace {
+
+const QStringList form_button_names = (QStringList()
+                                       << "refuse" << "hangup" << "answer"
+                                       << "close" << "save");
+
+}
+
+SheetFormCache::SheetFormCache(QObject *parent)
+    : QObject(parent)
+{
+}
+
+SheetFormCache::~SheetFormCache()
+{
+    foreach (const QString &key, m_templates.keys()) {
+        this->forgetTemplate(key);
+    }
+}
+
+/*! \brief a new instance of a form, parented to parent
+ *
+ * The returned widget belongs to the caller.
+ */
+SheetFormCache::Form SheetFormCache::takeForm(const QString &form_name, const QByteArray &ui_content, QWidget *parent)
+{
+    QString key = QString("%1:%2").arg(form_name)
+        .arg(QString(QCryptographicHash::hash(ui_content, QCryptographicHash::Sha1).toHex()));
+
+    const QString &previous_key = m_keys.value(form_name);
+    if (previous_key != key) {
+        // the form was changed on the server
+        this->forgetTemplate(previous_key);
+        m_keys[form_name] = key;
+    }
+
+    if (! m_templates.contains(key)) {
+        m_templates[key].ui_content = ui_content;
+    }
+    FormTemplate &form_template = m_templates[key];
+    Form form;
+    if (form_template.spares.isEmpty()) {
+        form.widget = this->load(ui_content, parent);
+    } else {
+        form.widget = form_template.spares.takeFirst();
+        form.widget->setParent(parent);
+    }
+    if (form.widget == NULL) {
+        return form;
+    }
+
+    if (! form_template.bound) {
+        static const QRegExp call_status_button("^XIVO_CALL_STATUS-");
+        foreach (QPushButton *button, form.widget->findChildren<QPushButton *>()) {
+            const QString &name = button->objectName();
+            if (form_button_names.contains(name) || call_status_button.indexIn(name) != -1) {
+                form_template.button_names.append(name);
+            }
+        }
+        form_template.bound = true;
+    }
+    form.button_names = form_template.button_names;
+
+    if (! m_missing_spares.contains(key)) {
+        m_missing_spares.append(key);
+        QTimer::singleShot(0, this, SLOT(loadSpares()));
+    }
+    return form;
+}
+
+void SheetFormCache::loadSpares()
+{
+    while (! m_missing_spares.isEmpty()) {
+        const QString &key = m_missing_spares.takeFirst();
+        if (! m_templates.contains(key)) {
+            continue;
+        }
+        FormTemplate &form_template = m_templates[key];
+        QWidget *spare = this->load(form_template.ui_content, NULL);
+        if (spare != NULL) {
+            form_template.spares.append(spare);
+        }
+    }
+}
+
+QWidget * SheetFormCache::load(const QByteArray &ui_content, QWidget *parent)
+{
+    QBuffer buffer;
+    buffer.setData(ui_content);
+    buffer.open(QIODevice::ReadOnly);
+    return m_loader.load(&buffer, parent);
+}
+
+void SheetFormCache::forgetTemplate(const QString &key)
+{
+    if (! m_templates.contains(key)) {
+        return;
+    }
+    qDeleteAll(m_templates.take(key).spares);
+    m_missing_spares.removeAll(key);
+}
@@ -0,0 +1,87 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __SHEET_FORM_CACHE_H__
+#define __SHEET_FORM_CACHE_H__
+
+#include <QByteArray>
+#include <QHash>
+#include <QList>
+#include <QObject>
+#include <QStringList>
+#include <QUiLoader>
+
+class QWidget;
+
+/*! \brief Loaded sheet forms, ready to be shown
+ *
+ * Forms are known by their name and the hash of their content. For each
+ * one, the names of the buttons a popup binds to are found once, and a
+ * spare instance is loaded while the client is idle so that the next
+ * popup using the form does not wait for QUiLoader.
+ */
+class SheetFormCache: public QObject
+{
+    Q_OBJECT
+
+    public:
+        /*! \brief a form instance and the buttons to bind in it */
+        struct Form {
+            Form() : widget(NULL) {}
+            QWidget *widget;
+            QStringList button_names;       //!< form and XIVO_CALL_STATUS- buttons of the form
+        };
+
+        SheetFormCache(QObject *parent = NULL);
+        ~SheetFormCache();
+
+        Form takeForm(const QString &form_name, const QByteArray &ui_content, QWidget *parent);
+
+    private slots:
+        void loadSpares();
+
+    private:
+        struct FormTemplate {
+            FormTemplate() : bound(false) {}
+            QByteArray ui_content;
+            QStringList button_names;
+            bool bound;                     //!< button_names were computed
+            QList<QWidget *> spares;
+        };
+
+        QWidget * load(const QByteArray &ui_content, QWidget *parent);
+        void forgetTemplate(const QString &key);
+
+        QUiLoader m_loader;
+        QHash<QString, FormTemplate> m_templates;       //!< form key -> template
+        QHash<QString, QString> m_keys;                 //!< form name -> key of its current content
+        QStringList m_missing_spares;                   //!< keys of the templates to load a spare for
+};
+
+#endif
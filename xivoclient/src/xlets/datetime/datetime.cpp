@@ -37,6 +37,17 @@ XLet* XLetDatetimePlugin::newXLetInstance(QWidget *parent)
     return new XletDatetime(parent);
 }
 
+QString XLetDatetimePlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/datetime_%1");
+    return XletDatetime::tr("Date and Time");
+}
+
+QString XLetDatetimePlugin::xletIconPath()
+{
+    return ":/images/tab-history.svg";
+}
+
 
 XletDatetime::XletDatetime(QWidget *parent)
     : XLet(parent, tr("Date and Time"), ":/images/tab-history.svg"),
@@ -50,7 +61,7 @@ XletDatetime::XletDatetime(QWidget *parent)
     layout->setRowStretch(0, 1);
     layout->setRowStretch(2, 1);
 
-    startTimer(1000);
+    m_timer_id = startTimer(1000);
 }
 
 /*! \brief method called periodically
@@ -61,3 +72,14 @@ void XletDatetime::timerEvent(QTimerEvent *)
 {
     m_datetime.setText(QDateTime::currentDateTime().toString(Qt::LocaleDate));
 }
+
+void XletDatetime::suspended()
+{
+    killTimer(m_timer_id);
+}
+
+void XletDatetime::resumed()
+{
+    this->timerEvent(NULL);
+    m_timer_id = startTimer(1000);
+}
@@ -46,19 +46,24 @@ class XletDatetime : public XLet
 
     protected:
         void timerEvent(QTimerEvent *);  //!< receive timer events
+        void suspended();
+        void resumed();
 
     private:
         QLabel m_datetime;
+        int m_timer_id;
 };
 
 class XLetDatetimePlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletdatetime.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletdatetime.json")
 
     public:
         XLet* newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
+        QString xletIconPath();
 };
 
 #endif /* __DATETIMEPANEL_H__ */
@@ -47,7 +47,7 @@ Directory::Directory(QWidget *parent)
 {
     this->ui.setupUi(this);
 
-    m_proxy_model = new DirectoryEntrySortFilterProxyModel(this);
+    m_proxy_model = new DirectoryEntrySortFilterProxyModel(m_directory_entry_manager, this);
     m_model = new DirectoryEntryModel(m_directory_entry_manager, this);
     m_proxy_model->setSourceModel(m_model);
     ui.entry_table->setModel(m_proxy_model);
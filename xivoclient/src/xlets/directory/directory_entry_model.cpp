@@ -46,6 +46,8 @@ DirectoryEntryModel::DirectoryEntryModel(const DirectoryEntryManager & directory
             this, SLOT(addDirectoryEntry(int)));
     connect(&m_directory_entry_manager, SIGNAL(directoryEntryUpdated(int)),
             this, SLOT(updateDirectoryEntry(int)));
+    connect(&m_directory_entry_manager, SIGNAL(directoryEntriesUpdated(int, int)),
+            this, SLOT(updateDirectoryEntries(int, int)));
     connect(&m_directory_entry_manager, SIGNAL(directoryEntryDeleted(int)),
             this, SLOT(deleteDirectoryEntry(int)));
 
@@ -81,6 +83,12 @@ void DirectoryEntryModel::updateDirectoryEntry(int entry_index) {
     this->refreshEntry(entry_index);
 }
 
+void DirectoryEntryModel::updateDirectoryEntries(int first_entry_index, int last_entry_index) {
+    QModelIndex cell_changed_start = createIndex(first_entry_index, 0);
+    QModelIndex cell_changed_end = createIndex(last_entry_index, this->columnCount() - 1);
+    emit dataChanged(cell_changed_start, cell_changed_end);
+}
+
 void DirectoryEntryModel::deleteDirectoryEntry(int entry_index) {
     this->removeRow(entry_index);
 }
@@ -61,6 +61,7 @@ class DirectoryEntryModel : public QAbstractTableModel, IPBXListener
     public slots:
         void addDirectoryEntry(int entry_index);
         void updateDirectoryEntry(int entry_index);
+        void updateDirectoryEntries(int first_entry_index, int last_entry_index);
         void deleteDirectoryEntry(int entry_index);
         void clearCache();
         void parseCommand(const QVariantMap &command);
@@ -30,9 +30,13 @@
 #include "directory_entry_model.h"
 #include "directory_entry_sort_filter_proxy_model.h"
 #include <xletlib/directory_entry.h>
+#include <xletlib/directory_entry_manager.h>
 
-DirectoryEntrySortFilterProxyModel::DirectoryEntrySortFilterProxyModel(QObject *parent)
-    : AbstractSortFilterProxyModel(parent)
+DirectoryEntrySortFilterProxyModel::DirectoryEntrySortFilterProxyModel(const DirectoryEntryManager &directory_entry_manager,
+                                                                       QObject *parent)
+    : AbstractSortFilterProxyModel(parent),
+      m_directory_entry_manager(directory_entry_manager),
+      m_candidates_revision(-1)
 {
 }
 
@@ -58,7 +62,7 @@ bool DirectoryEntrySortFilterProxyModel::filterAcceptsRow(int sourceRow, const Q
         }
     }
 
-    return this->filterMatchesEntry(sourceRow, sourceParent);
+    return this->filterMatchesEntry(sourceRow);
 }
 
 bool DirectoryEntrySortFilterProxyModel::lessThan(const QModelIndex &left,
@@ -86,22 +90,35 @@ bool DirectoryEntrySortFilterProxyModel::lessThan(const QModelIndex &left,
 
 void DirectoryEntrySortFilterProxyModel::setFilter(const QString & filter)
 {
-    this->m_filter = filter;
+    this->m_filter = DirectoryEntry::fold(filter);
+    this->m_candidates_revision = -1;
     this->invalidateFilter();
 }
 
-bool DirectoryEntrySortFilterProxyModel::filterMatchesEntry(int sourceRow, const QModelIndex & sourceParent) const
+/*! \brief whether the folded search key of the entry contains the filter
+ *
+ * Long enough filters are first checked against the candidates of the
+ * search index, which are computed again when the index changed.
+ */
+bool DirectoryEntrySortFilterProxyModel::filterMatchesEntry(int sourceRow) const
 {
+    if (sourceRow >= m_directory_entry_manager.entryCount()) {
+        return false;
+    }
+    const DirectoryEntry &entry = m_directory_entry_manager.getEntry(sourceRow);
 
-    QModelIndex directory_entry_index = sourceModel()->index(sourceRow,
-                                                             0,
-                                                             sourceParent);
-
-    QStringList search_list = sourceModel()->data(directory_entry_index,
-                                                  Qt::UserRole).toStringList();
+    if (m_filter.size() >= DirectorySearchIndex::gram_length) {
+        const DirectorySearchIndex &search_index = m_directory_entry_manager.searchIndex();
+        if (m_candidates_revision != search_index.revision()) {
+            m_candidates = search_index.candidates(m_filter);
+            m_candidates_revision = search_index.revision();
+        }
+        if (! m_candidates.contains(&entry)) {
+            return false;
+        }
+    }
 
-    bool empty = (search_list.filter(this->m_filter, Qt::CaseInsensitive).isEmpty());
-    return !empty;
+    return entry.searchKey().contains(m_filter);
 }
 
 QString DirectoryEntrySortFilterProxyModel::getNumber(const QModelIndex &index)
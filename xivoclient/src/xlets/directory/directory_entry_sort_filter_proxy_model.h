@@ -30,18 +30,23 @@
 #ifndef __DIRECTORY_ENTRY_SORT_FILTER_PROXY_MODEL_H__
 #define __DIRECTORY_ENTRY_SORT_FILTER_PROXY_MODEL_H__
 
+#include <QSet>
 #include <QStringList>
 
 #include <xletlib/abstract_sort_filter_proxy_model.h>
 
 #include "directory_entry_model.h"
 
+class DirectoryEntry;
+class DirectoryEntryManager;
+
 class DirectoryEntrySortFilterProxyModel : public AbstractSortFilterProxyModel
 {
     Q_OBJECT
 
     public:
-        DirectoryEntrySortFilterProxyModel(QObject *parent);
+        DirectoryEntrySortFilterProxyModel(const DirectoryEntryManager &directory_entry_manager,
+                                           QObject *parent);
     public slots:
         void setFilter(const QString & filter);
         QString getNumber(const QModelIndex &index);
@@ -49,10 +54,12 @@ class DirectoryEntrySortFilterProxyModel : public AbstractSortFilterProxyModel
         bool filterAcceptsRow(int , const QModelIndex &) const;
         virtual bool lessThan(const QModelIndex &left, const QModelIndex &right) const;
     private:
-        bool filterMatchesEntry(int sourceRow,
-                                const QModelIndex & sourceParent) const;
+        bool filterMatchesEntry(int sourceRow) const;
 
-        QString m_filter;
+        const DirectoryEntryManager &m_directory_entry_manager;
+        QString m_filter;                                       //!< folded by DirectoryEntry::fold
+        mutable QSet<const DirectoryEntry *> m_candidates;      //!< entries the search index gave for m_filter
+        mutable int m_candidates_revision;                      //!< search index revision of m_candidates
 };
 
 #endif
@@ -39,3 +39,9 @@ XLet * DirectoryPlugin::newXLetInstance(QWidget *parent)
     b_engine->registerTranslation(":/obj/directory_%1");
     return new Directory(parent);
 }
+
+QString DirectoryPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/directory_%1");
+    return Directory::tr("Directory");
+}
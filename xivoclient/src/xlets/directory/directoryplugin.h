@@ -38,9 +38,10 @@ class DirectoryPlugin: public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletdirectory.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletdirectory.json")
 public:
     XLet *newXLetInstance(QWidget *parent=0);
+    QString xletTitle();
 };
 
 #endif
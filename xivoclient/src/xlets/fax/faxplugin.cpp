@@ -39,3 +39,14 @@ XLet * FaxPlugin::newXLetInstance(QWidget *parent)
     b_engine->registerTranslation(":/obj/fax_%1");
     return new Fax(parent);
 }
+
+QString FaxPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/fax_%1");
+    return Fax::tr("Fax");
+}
+
+QString FaxPlugin::xletIconPath()
+{
+    return ":/images/tab-fax.svg";
+}
@@ -38,9 +38,11 @@ class FaxPlugin: public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletfax.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletfax.json")
 public:
     XLet *newXLetInstance(QWidget *parent=0);
+    QString xletTitle();
+    QString xletIconPath();
 };
 
 #endif
@@ -118,3 +118,14 @@ XLet* XLetHistoryPlugin::newXLetInstance(QWidget *parent)
     b_engine->registerTranslation(":/obj/history_%1");
     return new History(parent);
 }
+
+QString XLetHistoryPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/history_%1");
+    return History::tr("History");
+}
+
+QString XLetHistoryPlugin::xletIconPath()
+{
+    return ":/images/tab-history.svg";
+}
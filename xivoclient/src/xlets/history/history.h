@@ -72,10 +72,12 @@ class XLetHistoryPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xlethistory.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xlethistory.json")
 
     public:
         XLet* newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
+        QString xletIconPath();
 };
 
 #endif
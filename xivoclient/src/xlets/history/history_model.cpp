@@ -28,9 +28,11 @@
  */
 
 #include <QDateTime>
-#include <QIcon>
+#include <QGuiApplication>
 #include <QString>
 
+#include <xletlib/icon_cache.h>
+
 #include "history_model.h"
 
 QSize HistoryModel::icon_size = QSize(12, 12);
@@ -123,11 +125,14 @@ QVariant HistoryModel::data(const QModelIndex &a, int role) const
     } else if (role == Qt::DecorationRole && column == COL_NAME) {
         switch (item.mode) {
         case OUTCALL:
-            return QIcon(":/images/history/sent-call.svg").pixmap(icon_size);
+            return IconCache::pixmap(":/images/history/sent-call.svg", icon_size,
+                                     QColor(), qApp->devicePixelRatio());
         case INCALL:
-            return QIcon(":/images/history/received-call.svg").pixmap(icon_size);
+            return IconCache::pixmap(":/images/history/received-call.svg", icon_size,
+                                     QColor(), qApp->devicePixelRatio());
         case MISSEDCALL:
-            return QIcon(":/images/history/missed-call.svg").pixmap(icon_size);
+            return IconCache::pixmap(":/images/history/missed-call.svg", icon_size,
+                                     QColor(), qApp->devicePixelRatio());
         default:
             break;
         }
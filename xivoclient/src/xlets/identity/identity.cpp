@@ -49,6 +49,12 @@ XLet* XLetIdentityPlugin::newXLetInstance(QWidget *parent)
     return new IdentityDisplay(parent);
 }
 
+QString XLetIdentityPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/identity_%1");
+    return IdentityDisplay::tr("Identity");
+}
+
 IdentityDisplay::IdentityDisplay(QWidget *parent)
     : XLet(parent, tr("Identity")),
       m_hide_icon(":/identity/images/hide.svg"),
@@ -75,22 +81,19 @@ IdentityDisplay::IdentityDisplay(QWidget *parent)
     connect(this->ui.cancel_transfer, SIGNAL(clicked()),
             this, SLOT(cancelTransfer()));
 
-    connect(b_engine, SIGNAL(updateUserConfig(const QString &)),
-            this, SLOT(updateUserConfig(const QString &)));
-    connect(b_engine, SIGNAL(updatePhoneConfig(const QString &)),
-            this, SLOT(updatePhoneConfig(const QString &)));
-    connect(b_engine, SIGNAL(updateVoiceMailConfig(const QString &)),
-            this, SLOT(updateVoiceMailConfig(const QString &)));
-
-    connect(b_engine, SIGNAL(updateAgentStatus(const QString &)),
-            this, SLOT(updateAgentStatus(const QString &)));
-    connect(b_engine, SIGNAL(updateUserStatus(const QString &)),
-            this, SLOT(updateUserStatus(const QString &)));
-    connect(b_engine, SIGNAL(updateVoiceMailStatus(const QString &)),
-            this, SLOT(updateVoiceMailStatus(const QString &)));
+    this->subscribeToUserUpdates();
 
     connect(b_engine, SIGNAL(settingsChanged()),
             this, SLOT(updatePresenceVisibility()));
+
+    // the user is already known when the xlet is spawned after login
+    if (m_ui != NULL) {
+        this->updateUserConfig(m_xuserid);
+        this->updateUserStatus(m_xuserid);
+        this->updateAgentStatus(m_ui->xagentid());
+        this->updateVoiceMailConfig(m_ui->xvoicemailid());
+        this->updateVoiceMailStatus(m_ui->xvoicemailid());
+    }
 }
 
 void IdentityDisplay::fillAgentMenu(QMenu *menu)
@@ -128,6 +131,39 @@ void IdentityDisplay::doGUIConnects(QWidget * mainwindow)
             mainwindow, SLOT(setAppIcon(const QString &)));
 }
 
+/*! \brief receive only the updates of the user and of its phones, agent and voicemail
+ *
+ * Called again when the phones, agent or voicemail of the user change
+ * with its config.
+ */
+void IdentityDisplay::subscribeToUserUpdates()
+{
+    UpdateRouter &router = b_engine->updateRouter();
+    router.unsubscribe(this);
+
+    router.subscribe("users", UpdateRouter::CONFIG, m_xuserid,
+                     this, SLOT(updateUserConfig(const QString &)));
+    router.subscribe("users", UpdateRouter::STATUS, m_xuserid,
+                     this, SLOT(updateUserStatus(const QString &)));
+    if (m_ui == NULL) {
+        return;
+    }
+
+    m_subscribed_phone_ids = m_ui->phonelist();
+    m_subscribed_agent_id = m_ui->xagentid();
+    m_subscribed_voicemail_id = m_ui->xvoicemailid();
+    foreach (const QString &phone_id, m_ui->phonelist()) {
+        router.subscribe("phones", UpdateRouter::CONFIG, phone_id,
+                         this, SLOT(updatePhoneConfig(const QString &)));
+    }
+    router.subscribe("agents", UpdateRouter::STATUS, m_ui->xagentid(),
+                     this, SLOT(updateAgentStatus(const QString &)));
+    router.subscribe("voicemails", UpdateRouter::CONFIG, m_ui->xvoicemailid(),
+                     this, SLOT(updateVoiceMailConfig(const QString &)));
+    router.subscribe("voicemails", UpdateRouter::STATUS, m_ui->xvoicemailid(),
+                     this, SLOT(updateVoiceMailStatus(const QString &)));
+}
+
 void IdentityDisplay::updatePhoneConfig(const QString & xphoneid)
 {
     if (m_ui == NULL)
@@ -147,6 +183,11 @@ void IdentityDisplay::updateUserConfig(const QString & xuserid)
         return;
     if (m_ui == NULL)
         return;
+    if (m_ui->phonelist() != m_subscribed_phone_ids
+        || m_ui->xagentid() != m_subscribed_agent_id
+        || m_ui->xvoicemailid() != m_subscribed_voicemail_id) {
+        this->subscribeToUserUpdates();
+    }
     this->ui.name->setText(m_ui->fullname());
     this->updateNameTooltip();
     this->updateAgentVisibility();
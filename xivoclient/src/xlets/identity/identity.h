@@ -87,6 +87,7 @@ class IdentityDisplay : public XLet
         void updateCurrentPresence();
         void updateNameTooltip();
         void updateOptions();
+        void subscribeToUserUpdates();
         void updateVoiceMailVisibility();
 
         QIcon m_hide_icon;
@@ -96,16 +97,21 @@ class IdentityDisplay : public XLet
         QSignalMapper *m_presence_mapper;
         Menu *m_agent_menu;
         Menu *m_presence_menu;
+
+        QStringList m_subscribed_phone_ids;     //!< phones of the user when subscribing
+        QString m_subscribed_agent_id;          //!< agent of the user when subscribing
+        QString m_subscribed_voicemail_id;      //!< voicemail of the user when subscribing
 };
 
 class XLetIdentityPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletidentity.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletidentity.json")
 
     public:
         XLet* newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
 };
 
 #endif
@@ -157,6 +157,15 @@ void People::parseCommand(const QVariantMap &command)
         this->setSuccessStatus();
     }
 
+    if (event == "people_favorite_update" ||
+        event == "people_personal_contact_created" ||
+        event == "people_personal_contact_deleted" ||
+        event == "people_personal_contact_raw_update" ||
+        event == "people_personal_contacts_purged")
+    {
+        m_search_cache.clear();
+    }
+
     if (event == "agent_status_update") {
         m_model->parseAgentStatusUpdate(command);
     } else if (event == "endpoint_status_update") {
@@ -166,7 +175,7 @@ void People::parseCommand(const QVariantMap &command)
     } else if (event == "people_headers_result") {
         m_model->parsePeopleHeadersResult(command);
     } else if (event == "people_search_result") {
-        m_model->parsePeopleSearchResult(command);
+        this->parsePeopleSearchResult(command);
     } else if (event == "people_favorites_result") {
         m_model->parsePeopleSearchResult(command);
     } else if (event == "people_personal_contacts_result") {
@@ -190,6 +199,44 @@ void People::parseCommand(const QVariantMap &command)
     }
 }
 
+/*! \brief show the results of a search, unless the user typed another pattern since
+ *
+ * A late answer for a shorter pattern still refines what is shown, through
+ * the cache.
+ */
+void People::parsePeopleSearchResult(const QVariantMap &result)
+{
+    const QString &term = result["term"].toString();
+    m_search_cache.insert(term, result["results"].toList());
+
+    if (m_searched_pattern.isEmpty() ||
+        PeopleSearchCache::normalized(term) == PeopleSearchCache::normalized(m_searched_pattern))
+    {
+        m_model->parsePeopleSearchResult(result);
+    } else if (m_mode == SEARCH_MODE) {
+        this->showCachedSearchResults();
+    }
+}
+
+/*! \brief show what the cache knows of the searched pattern
+ *
+ * \return true when the cached results are recent enough to skip asking
+ *         the server
+ */
+bool People::showCachedSearchResults()
+{
+    QVariantList results;
+    bool up_to_date = false;
+    if (! m_search_cache.lookup(m_searched_pattern, &results, &up_to_date)) {
+        return false;
+    }
+
+    QVariantMap cached_result;
+    cached_result["results"] = results;
+    m_model->parsePeopleSearchResult(cached_result);
+    return up_to_date;
+}
+
 void People::parsePeoplePersonalContactDeleted(const QVariantMap &result)
 {
     const QString &source = result["source"].toString();
@@ -257,6 +304,10 @@ void People::updatePersonalContacts()
 void People::schedulePeopleLookup(const QString &lookup_pattern)
 {
     m_searched_pattern = lookup_pattern;
+    if (m_mode == SEARCH_MODE && this->showCachedSearchResults()) {
+        m_lookup_timer.stop();
+        return;
+    }
     m_lookup_timer.start();
 }
 
@@ -270,6 +321,9 @@ void People::searchPeople()
     if (m_mode != SEARCH_MODE) {
         this->ui.menu->setSelectedAction(0);
     }
+    if (this->showCachedSearchResults()) {
+        return;
+    }
     this->waitingStatusAboutToBeStarted();
     b_engine->sendJsonCommand(MessageFactory::peopleSearch(m_searched_pattern));
     qDebug() << Q_FUNC_INFO << "searching" << m_searched_pattern << "...";
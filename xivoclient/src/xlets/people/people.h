@@ -43,6 +43,7 @@
 #include <ui_people_widget.h>
 
 #include "people_enum.h"
+#include "people_search_cache.h"
 
 class PeopleEntryModel;
 class PeopleEntrySortFilterProxyModel;
@@ -98,6 +99,8 @@ class People: public XLet, public IPBXListener
         void parsePeoplePersonalContactRawResult(const QVariantMap &result);
         void parsePeopleExportPersonalContactsCSVResult(const QVariantMap &result);
         void parsePeopleImportPersonalContactsCSVResult(const QVariantMap &result);
+        void parsePeopleSearchResult(const QVariantMap &result);
+        bool showCachedSearchResults();
         void openExportDialog();
         void setSuccessStatus();
         void updatePersonalContacts();
@@ -111,6 +114,7 @@ class People: public XLet, public IPBXListener
         QTimer m_failure_timer;
         QTimer m_lookup_timer;
         QString m_searched_pattern;
+        PeopleSearchCache m_search_cache;
         PeopleMode m_mode;
         QByteArray m_csv_contacts;
 
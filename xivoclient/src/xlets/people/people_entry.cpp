@@ -40,6 +40,7 @@ PeopleEntry::PeopleEntry(const QVariantList &data,
   : m_data(data),
     m_xivo_uuid(xivo_uuid),
     m_source_name(source_name),
+    m_endpoint_status(-1),
     m_source_entry_id(source_entry_id),
     m_user_uuid(user_uuid),
     m_agent_id(agent_id),
@@ -49,6 +50,10 @@ PeopleEntry::PeopleEntry(const QVariantList &data,
 }
 
 PeopleEntry::PeopleEntry()
+  : m_endpoint_status(-1),
+    m_agent_id(0),
+    m_user_id(0),
+    m_endpoint_id(0)
 {
 }
 
@@ -66,6 +71,22 @@ void PeopleEntry::setData(int column, const QVariant &status)
     this->m_data.replace(column, status);
 }
 
+/*! \brief true when both entries show the same values for the same relations
+ *
+ * Statuses are not compared, they are not part of the search results.
+ */
+bool PeopleEntry::hasSameContent(const PeopleEntry &other) const
+{
+    return m_data == other.m_data
+        && m_xivo_uuid == other.m_xivo_uuid
+        && m_source_name == other.m_source_name
+        && m_source_entry_id == other.m_source_entry_id
+        && m_user_uuid == other.m_user_uuid
+        && m_agent_id == other.m_agent_id
+        && m_user_id == other.m_user_id
+        && m_endpoint_id == other.m_endpoint_id;
+}
+
 const QString &PeopleEntry::xivoUuid() const
 {
     return this->m_xivo_uuid;
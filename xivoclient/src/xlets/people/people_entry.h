@@ -47,6 +47,7 @@ class PeopleEntry
         ~PeopleEntry();
         const QVariant data(int column) const;
         void setData(int column, const QVariant &status);
+        bool hasSameContent(const PeopleEntry &other) const;
 
         const QString &xivoUuid() const;
         const QString &userUuid() const;
@@ -35,6 +35,8 @@
 #include <QPainter>
 #include <QVariant>
 
+#include <xletlib/icon_cache.h>
+
 #include "people_action_generator.h"
 #include "people_entry_delegate.h"
 
@@ -79,16 +81,12 @@ void PeopleEntryDotDelegate::paint(QPainter *painter,
         return;
     }
 
-    QIcon dot = QIcon(":/images/dot.svg");
-    QPixmap tinted_image = dot.pixmap(icon_size);
+    QPixmap tinted_image = IconCache::pixmap(":/images/dot.svg", icon_size,
+                                             index.data(INDICATOR_COLOR_ROLE).value<QColor>(),
+                                             painter);
 
     int icon_left = opt.rect.x();
-    int icon_top = opt.rect.center().y() - tinted_image.height() / 2;
-
-    QPainter tint_painter(&tinted_image);
-    tint_painter.setCompositionMode(QPainter::CompositionMode_SourceAtop);
-    tint_painter.fillRect(tinted_image.rect(), QColor(index.data(INDICATOR_COLOR_ROLE).value<QColor>()));
-    tint_painter.end();
+    int icon_top = opt.rect.center().y() - icon_size.height() / 2;
 
     painter->save();
     painter->drawPixmap(icon_left, icon_top, tinted_image);
@@ -138,7 +136,8 @@ void PeopleEntryNumberDelegate::paint(QPainter *painter,
             QSize arrow_image_size = QSize(9, 6);
             arrow_image_rect.setSize(arrow_image_size);
             arrow_image_rect.moveCenter(selector_rect.center());
-            painter->drawPixmap(arrow_image_rect, QIcon(":/images/down-arrow-white.svg").pixmap(arrow_image_size));
+            painter->drawPixmap(arrow_image_rect,
+                                IconCache::pixmap(":/images/down-arrow-white.svg", arrow_image_size, QColor(), painter));
         }
         painter->restore();
         PeopleEntryDotDelegate::drawBorder(painter, option);
@@ -298,15 +297,15 @@ void PeopleEntryPersonalContactDelegate::paint(QPainter *painter,
     QStyleOptionViewItem opt = option;
     opt.rect = AbstractItemDelegate::marginsRemovedByColumn(option.rect, index.column());
 
-    QPixmap edit_image = QIcon(":/images/edit-contact.svg").pixmap(icon_size);
+    QPixmap edit_image = IconCache::pixmap(":/images/edit-contact.svg", icon_size, QColor(), painter);
 
     int icon_edit_left = opt.rect.left();
-    int icon_edit_top = opt.rect.center().y() - edit_image.height() / 2;
+    int icon_edit_top = opt.rect.center().y() - icon_size.height() / 2;
 
-    QPixmap trash_image = QIcon(":/images/delete-contact.svg").pixmap(icon_size);
+    QPixmap trash_image = IconCache::pixmap(":/images/delete-contact.svg", icon_size, QColor(), painter);
 
     int icon_trash_left = opt.rect.left() + icon_size.width() + icons_spacing;
-    int icon_trash_top = opt.rect.center().y() - trash_image.height() / 2;
+    int icon_trash_top = opt.rect.center().y() - icon_size.height() / 2;
 
     painter->save();
     painter->drawPixmap(icon_edit_left, icon_edit_top, edit_image);
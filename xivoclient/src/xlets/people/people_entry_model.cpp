@@ -48,6 +48,9 @@ PeopleEntryModel::PeopleEntryModel(QWidget *parent)
     this->m_type_map["personal"] = PERSONAL_CONTACT;
     this->m_type_map["status"] = STATUS_ICON;
     this->m_type_map["voicemail"] = VOICEMAIL;
+
+    connect(b_engine, SIGNAL(delogged()),
+            this, SLOT(forgetRegisteredIds()));
 }
 
 void PeopleEntryModel::addField(const QString &name, const QString &type)
@@ -83,6 +86,7 @@ void PeopleEntryModel::clearEntries()
 {
     this->beginResetModel();
     m_people_entries.clear();
+    this->indexEntries();
     this->endResetModel();
 }
 
@@ -274,27 +278,25 @@ int PeopleEntryModel::getNameColumnIndex() const
 
 bool PeopleEntryModel::favoriteStatus(const QVariantMap &unique_source_entry_id) const
 {
-    QPair<QString, QString> id(unique_source_entry_id["source"].toString(),
-                               unique_source_entry_id["source_entry_id"].toString());
+    RelationSourceID id(unique_source_entry_id["source"].toString(),
+                        unique_source_entry_id["source_entry_id"].toString());
 
-    foreach(const PeopleEntry &entry, m_people_entries) {
-        if (entry.uniqueSourceId() == id) {
-            foreach(int column, indexesFromType(FAVORITE)) {
-                return entry.data(column).toBool();
-            }
-        }
+    int row = m_rows_by_source_id.value(id, -1);
+    if (row == -1) {
+        return false;
+    }
+    foreach(int column, indexesFromType(FAVORITE)) {
+        return m_people_entries[row].data(column).toBool();
     }
     return false;
 }
 
 void PeopleEntryModel::removeRowFromSourceEntryId(const QString &source, const QString &source_entry_id)
 {
-    RelationSourceID id(source, source_entry_id);
-    for (int i = 0; i < this->rowCount(); ++i) {
-        PeopleEntry &entry = m_people_entries[i];
-        if (entry.uniqueSourceId() == id) {
-            this->removeRow(i);
-        }
+    QList<int> rows = m_rows_by_source_id.values(RelationSourceID(source, source_entry_id));
+    qSort(rows.begin(), rows.end(), qGreater<int>());
+    foreach(int row, rows) {
+        this->removeRow(row);
     }
 }
 
@@ -305,57 +307,105 @@ bool PeopleEntryModel::removeRows(int row, int count, const QModelIndex &parent)
     }
     this->beginRemoveRows(parent, row, row + count - 1);
     m_people_entries.remove(row, count);
+    this->indexEntries();
     this->endRemoveRows();
     return true;
 }
 
-void PeopleEntryModel::setAgentStatusFromAgentId(const RelationID &id, const QString &status)
+/*! \brief rebuild the relation id -> rows indexes after rows were added or removed */
+void PeopleEntryModel::indexEntries()
 {
-    for (int i = 0; i < m_people_entries.size(); ++i) {
-        PeopleEntry &entry = m_people_entries[i];
-        if (entry.uniqueAgentId() == id) {
-            entry.setAgentStatus(status);
-            this->refreshEntry(i);
+    m_rows_by_agent_id.clear();
+    m_rows_by_endpoint_id.clear();
+    m_rows_by_user_id.clear();
+    m_rows_by_source_id.clear();
+
+    for (int row = 0; row < m_people_entries.size(); ++row) {
+        const PeopleEntry &entry = m_people_entries[row];
+        if (entry.agentId() != 0) {
+            m_rows_by_agent_id.insert(entry.uniqueAgentId(), row);
+        }
+        if (entry.endpointId() != 0) {
+            m_rows_by_endpoint_id.insert(entry.uniqueEndpointId(), row);
+        }
+        if (! entry.userUuid().isEmpty()) {
+            m_rows_by_user_id.insert(RelationUserID(entry.xivoUuid(), entry.userUuid()), row);
+        }
+        if (! entry.sourceEntryId().isEmpty()) {
+            m_rows_by_source_id.insert(entry.uniqueSourceId(), row);
         }
     }
 }
 
+void PeopleEntryModel::setAgentStatusFromAgentId(const RelationID &id, const QString &status)
+{
+    m_agent_statuses[id] = status;
+    foreach(int row, m_rows_by_agent_id.values(id)) {
+        m_people_entries[row].setAgentStatus(status);
+        this->refreshEntry(row);
+    }
+}
+
 void PeopleEntryModel::setEndpointStatusFromEndpointId(const RelationID &id, int status)
 {
-    for (int i = 0; i < m_people_entries.size(); ++i) {
-        PeopleEntry &entry = m_people_entries[i];
-        if (entry.uniqueEndpointId() == id) {
-            entry.setEndpointStatus(status);
-            this->refreshEntry(i);
-        }
+    m_endpoint_statuses[id] = status;
+    foreach(int row, m_rows_by_endpoint_id.values(id)) {
+        m_people_entries[row].setEndpointStatus(status);
+        this->refreshEntry(row);
     }
 }
 
-void PeopleEntryModel::setUserStatusFromUserId(const QPair<QString, QString> &id, const QString &status)
+void PeopleEntryModel::setUserStatusFromUserId(const RelationUserID &id, const QString &status)
 {
-    for (int i = 0; i < m_people_entries.size(); ++i) {
-        PeopleEntry &entry = m_people_entries[i];
-        QPair<QString, QString> current(entry.xivoUuid(), entry.userUuid());
-        if (current == id) {
-            entry.setUserStatus(status);
-            this->refreshEntry(i);
-        }
+    m_user_statuses[id] = status;
+    foreach(int row, m_rows_by_user_id.values(id)) {
+        m_people_entries[row].setUserStatus(status);
+        this->refreshEntry(row);
     }
 }
 
 void PeopleEntryModel::setFavoriteStatusFromSourceId(const RelationSourceID &id, bool status)
 {
-    for (int i = 0; i < m_people_entries.size(); ++i) {
-        PeopleEntry &entry = m_people_entries[i];
-        if (entry.uniqueSourceId() == id) {
-            foreach(int column, indexesFromType(FAVORITE)) {
-                entry.setData(column, status);
-                this->refreshEntry(i);
-            }
+    foreach(int row, m_rows_by_source_id.values(id)) {
+        PeopleEntry &entry = m_people_entries[row];
+        foreach(int column, indexesFromType(FAVORITE)) {
+            entry.setData(column, status);
+            this->refreshEntry(row);
         }
     }
 }
 
+/*! \brief the statuses received for relations that were registered earlier
+ *
+ * The server only sends a status when it changes or when it is registered,
+ * so entries of a new search take the last ones received.
+ */
+void PeopleEntryModel::applyKnownStatuses(PeopleEntry &entry) const
+{
+    const RelationID &agent_id = entry.uniqueAgentId();
+    if (m_agent_statuses.contains(agent_id)) {
+        entry.setAgentStatus(m_agent_statuses[agent_id]);
+    }
+    const RelationID &endpoint_id = entry.uniqueEndpointId();
+    if (m_endpoint_statuses.contains(endpoint_id)) {
+        entry.setEndpointStatus(m_endpoint_statuses[endpoint_id]);
+    }
+    RelationUserID user_id(entry.xivoUuid(), entry.userUuid());
+    if (m_user_statuses.contains(user_id)) {
+        entry.setUserStatus(m_user_statuses[user_id]);
+    }
+}
+
+void PeopleEntryModel::forgetRegisteredIds()
+{
+    m_registered_agent_ids.clear();
+    m_registered_endpoint_ids.clear();
+    m_registered_user_ids.clear();
+    m_agent_statuses.clear();
+    m_endpoint_statuses.clear();
+    m_user_statuses.clear();
+}
+
 void PeopleEntryModel::parseAgentStatusUpdate(const QVariantMap &result)
 {
     RelationID id(result["data"].toMap()["xivo_uuid"].toString(),
@@ -376,8 +426,8 @@ void PeopleEntryModel::parseEndpointStatusUpdate(const QVariantMap &result)
 
 void PeopleEntryModel::parseUserStatusUpdate(const QVariantMap &result)
 {
-    QPair<QString, QString> id(result["data"].toMap()["xivo_uuid"].toString(),
-                               result["data"].toMap()["user_uuid"].toString());
+    RelationUserID id(result["data"].toMap()["xivo_uuid"].toString(),
+                      result["data"].toMap()["user_uuid"].toString());
     const QString &new_status = result["data"].toMap()["status"].toString();
 
     this->setUserStatusFromUserId(id, new_status);
@@ -414,42 +464,131 @@ void PeopleEntryModel::parsePeopleHeadersResult(const QVariantMap &result)
     this->endInsertColumns();
 }
 
+/*! \brief merge the results of a search into the current rows
+ *
+ * Results are matched to the current rows by their source entry id, so a
+ * refined search only removes, moves or inserts the rows that differ and
+ * the view keeps its scroll position and selection.
+ */
 void PeopleEntryModel::parsePeopleSearchResult(const QVariantMap &result)
 {
     const QList<QVariant> &entries = result["results"].toList();
-    QVariantList endpoint_ids;
-    QVariantList agent_ids;
-    QVariantList user_ids;
 
-    this->beginResetModel();
-    m_people_entries.clear();
+    QVector<PeopleEntry> new_entries;
+    QSet<RelationSourceID> new_source_ids;
     foreach(const QVariant &result, entries) {
-        QVariantMap entry_map = result.toMap();
-        const QVariantMap &relations = entry_map["relations"].toMap();
-
-        PeopleEntry entry(entry_map["column_values"].toList(),
-                          relations["xivo_id"].toString(),
-                          entry_map["source"].toString(),
-                          relations["source_entry_id"].toString(),
-                          relations["user_uuid"].toString(),
-                          relations["agent_id"].toInt(),
-                          relations["endpoint_id"].toInt(),
-                          relations["user_id"].toInt()
-                         );
-        const QString &xivo_id = entry.xivoUuid();
-        if (entry.agentId() != 0) {
-            agent_ids.push_back(newIdAsList(xivo_id, entry.agentId()));
+        new_entries.append(this->entryFromResult(result.toMap()));
+        if (! new_entries.last().sourceEntryId().isEmpty()) {
+            new_source_ids.insert(new_entries.last().uniqueSourceId());
         }
-        if (entry.endpointId() != 0) {
-            endpoint_ids.push_back(newIdAsList(xivo_id, entry.endpointId()));
+    }
+
+    if (m_people_entries.isEmpty()) {
+        this->beginResetModel();
+        for (int row = 0; row < new_entries.size(); ++row) {
+            this->applyKnownStatuses(new_entries[row]);
         }
-        if (entry.userUuid() != "") {
-            user_ids.push_back(newIdAsList(xivo_id, entry.userUuid()));
+        m_people_entries = new_entries;
+        this->indexEntries();
+        this->endResetModel();
+        this->registerNewIds();
+        return;
+    }
+
+    for (int row = m_people_entries.size() - 1; row >= 0; --row) {
+        const PeopleEntry &entry = m_people_entries[row];
+        if (entry.sourceEntryId().isEmpty() || ! new_source_ids.contains(entry.uniqueSourceId())) {
+            this->beginRemoveRows(QModelIndex(), row, row);
+            m_people_entries.remove(row);
+            this->endRemoveRows();
         }
+    }
 
-        m_people_entries.append(entry);
+    QList<int> changed_rows;
+    for (int row = 0; row < new_entries.size(); ++row) {
+        PeopleEntry &entry = new_entries[row];
+        int current_row = -1;
+        if (! entry.sourceEntryId().isEmpty()) {
+            current_row = this->rowOfSourceId(entry.uniqueSourceId(), row);
+        }
+        if (current_row == -1) {
+            this->applyKnownStatuses(entry);
+            this->beginInsertRows(QModelIndex(), row, row);
+            m_people_entries.insert(row, entry);
+            this->endInsertRows();
+            continue;
+        }
+        if (current_row != row) {
+            this->beginMoveRows(QModelIndex(), current_row, current_row, QModelIndex(), row);
+            PeopleEntry moved = m_people_entries[current_row];
+            m_people_entries.remove(current_row);
+            m_people_entries.insert(row, moved);
+            this->endMoveRows();
+        }
+        if (! m_people_entries[row].hasSameContent(entry)) {
+            this->applyKnownStatuses(entry);
+            m_people_entries[row] = entry;
+            changed_rows.append(row);
+        }
+    }
+    this->indexEntries();
+
+    foreach(int row, changed_rows) {
+        this->refreshEntry(row);
+    }
+
+    this->registerNewIds();
+}
+
+PeopleEntry PeopleEntryModel::entryFromResult(const QVariantMap &entry_map) const
+{
+    const QVariantMap &relations = entry_map["relations"].toMap();
+
+    return PeopleEntry(entry_map["column_values"].toList(),
+                       relations["xivo_id"].toString(),
+                       entry_map["source"].toString(),
+                       relations["source_entry_id"].toString(),
+                       relations["user_uuid"].toString(),
+                       relations["agent_id"].toInt(),
+                       relations["endpoint_id"].toInt(),
+                       relations["user_id"].toInt()
+                      );
+}
+
+int PeopleEntryModel::rowOfSourceId(const RelationSourceID &id, int from) const
+{
+    for (int row = from; row < m_people_entries.size(); ++row) {
+        if (m_people_entries[row].uniqueSourceId() == id) {
+            return row;
+        }
+    }
+    return -1;
+}
+
+/*! \brief subscribe to the statuses of the relations shown for the first time */
+void PeopleEntryModel::registerNewIds()
+{
+    QVariantList agent_ids;
+    foreach(const RelationID &id, m_rows_by_agent_id.uniqueKeys()) {
+        if (! m_registered_agent_ids.contains(id)) {
+            m_registered_agent_ids.insert(id);
+            agent_ids.push_back(newIdAsList(id.first, id.second));
+        }
+    }
+    QVariantList endpoint_ids;
+    foreach(const RelationID &id, m_rows_by_endpoint_id.uniqueKeys()) {
+        if (! m_registered_endpoint_ids.contains(id)) {
+            m_registered_endpoint_ids.insert(id);
+            endpoint_ids.push_back(newIdAsList(id.first, id.second));
+        }
+    }
+    QVariantList user_ids;
+    foreach(const RelationUserID &id, m_rows_by_user_id.uniqueKeys()) {
+        if (! m_registered_user_ids.contains(id)) {
+            m_registered_user_ids.insert(id);
+            user_ids.push_back(newIdAsList(id.first, id.second));
+        }
     }
-    this->endResetModel();
 
     if (!agent_ids.empty()) {
         b_engine->sendJsonCommand(MessageFactory::registerAgentStatus(agent_ids));
@@ -30,9 +30,12 @@
 #ifndef __PEOPLE_ENTRY_MODEL_H__
 #define __PEOPLE_ENTRY_MODEL_H__
 
+#include <QHash>
 #include <QMap>
 #include <QModelIndex>
+#include <QMultiHash>
 #include <QPair>
+#include <QSet>
 #include <QString>
 #include <QVariant>
 #include <QVector>
@@ -50,6 +53,7 @@ class PeopleEntryModel : public AbstractTableModel
     Q_OBJECT
 
     typedef QPair<QString, QString> RelationSourceID;
+    typedef QPair<QString, QString> RelationUserID;
 
     public:
         PeopleEntryModel(QWidget *parent);
@@ -74,7 +78,15 @@ class PeopleEntryModel : public AbstractTableModel
         virtual QList<int> columnDisplayBold() const;
         virtual bool removeRows(int row, int count, const QModelIndex &parent = QModelIndex());
 
+    private slots:
+        void forgetRegisteredIds();
+
     private:
+        PeopleEntry entryFromResult(const QVariantMap &entry_map) const;
+        int rowOfSourceId(const RelationSourceID &id, int from) const;
+        void applyKnownStatuses(PeopleEntry &entry) const;
+        void indexEntries();
+        void registerNewIds();
         void refreshEntry(int entry_index);
         QVariant dataDecoration(const PeopleEntry & entry, int column) const;
         QVariant dataIndicatorColor(const PeopleEntry & entry, int column) const;
@@ -84,7 +96,7 @@ class PeopleEntryModel : public AbstractTableModel
         void clearFields();
         void setAgentStatusFromAgentId(const RelationID &id, const QString &status);
         void setEndpointStatusFromEndpointId(const RelationID &id, int status);
-        void setUserStatusFromUserId(const QPair<QString, QString> &id, const QString &status);
+        void setUserStatusFromUserId(const RelationUserID &id, const QString &status);
         void setFavoriteStatusFromSourceId(const RelationSourceID &id, bool status);
         QVariantList newIdAsList(const QString &xivo_uuid, int id) const;
         QVariantList newIdAsList(const QString &xivo_uuid, const QString &user_uuid) const;
@@ -97,6 +109,18 @@ class PeopleEntryModel : public AbstractTableModel
         QList< QPair<QString, enum ColumnType> >  m_fields;
         QVector<PeopleEntry> m_people_entries;
         QMap<QString, ColumnType> m_type_map;
+
+        QMultiHash<RelationID, int> m_rows_by_agent_id;
+        QMultiHash<RelationID, int> m_rows_by_endpoint_id;
+        QMultiHash<RelationUserID, int> m_rows_by_user_id;
+        QMultiHash<RelationSourceID, int> m_rows_by_source_id;
+
+        QHash<RelationID, QString> m_agent_statuses;        //!< last status received for each agent
+        QHash<RelationID, int> m_endpoint_statuses;         //!< last status received for each endpoint
+        QHash<RelationUserID, QString> m_user_statuses;     //!< last status received for each user
+        QSet<RelationID> m_registered_agent_ids;
+        QSet<RelationID> m_registered_endpoint_ids;
+        QSet<RelationUserID> m_registered_user_ids;
 };
 
 #endif
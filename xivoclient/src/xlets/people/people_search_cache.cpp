@@ -0,0 +1,121 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#include "people_search_cache.h"
+
+PeopleSearchCache::PeopleSearchCache(int capacity)
+    : m_capacity(capacity)
+{
+}
+
+void PeopleSearchCache::insert(const QString &pattern, const QVariantList &results)
+{
+    const QString &key = normalized(pattern);
+    if (key.isEmpty()) {
+        return;
+    }
+
+    CachedSearch &search = m_searches[key];
+    search.results = results;
+    search.age.start();
+    this->touch(key);
+
+    while (m_recent_patterns.size() > m_capacity) {
+        m_searches.remove(m_recent_patterns.takeLast());
+    }
+}
+
+/*! \brief the results of pattern, from the closest cached search
+ *
+ * up_to_date is set when the pattern itself was searched recently, in
+ * which case there is no need to ask the server again.
+ */
+bool PeopleSearchCache::lookup(const QString &pattern, QVariantList *results, bool *up_to_date) const
+{
+    const QString &key = normalized(pattern);
+    *up_to_date = false;
+    if (key.isEmpty()) {
+        return false;
+    }
+
+    if (m_searches.contains(key)) {
+        const CachedSearch &search = m_searches[key];
+        *results = search.results;
+        *up_to_date = search.age.elapsed() < max_age;
+        this->touch(key);
+        return true;
+    }
+
+    QString superset_key;
+    foreach (const QString &cached_key, m_recent_patterns) {
+        if (key.startsWith(cached_key) && cached_key.size() > superset_key.size()) {
+            superset_key = cached_key;
+        }
+    }
+    if (superset_key.isEmpty()) {
+        return false;
+    }
+
+    results->clear();
+    foreach (const QVariant &result, m_searches[superset_key].results) {
+        if (matches(result.toMap(), key)) {
+            results->append(result);
+        }
+    }
+    this->touch(superset_key);
+    return true;
+}
+
+void PeopleSearchCache::clear()
+{
+    m_searches.clear();
+    m_recent_patterns.clear();
+}
+
+QString PeopleSearchCache::normalized(const QString &pattern)
+{
+    return pattern.simplified().toLower();
+}
+
+bool PeopleSearchCache::matches(const QVariantMap &result, const QString &pattern)
+{
+    foreach (const QVariant &value, result["column_values"].toList()) {
+        if (value.type() == QVariant::String
+            && value.toString().contains(pattern, Qt::CaseInsensitive)) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void PeopleSearchCache::touch(const QString &pattern) const
+{
+    m_recent_patterns.removeOne(pattern);
+    m_recent_patterns.prepend(pattern);
+}
@@ -0,0 +1,71 @@
+/* XiVO Client
+ * Copyright (C) 2016 Avencall
+ *
+ * This file is part of XiVO Client.
+ *
+ * XiVO Client is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version, with a Section 7 Additional
+ * Permission as follows:
+ *   This notice constitutes a grant of such permission as is necessary
+ *   to combine or link this software, or a modified version of it, with
+ *   the OpenSSL project's "OpenSSL" library, or a derivative work of it,
+ *   and to copy, modify, and distribute the resulting work. This is an
+ *   extension of the special permission given by Trolltech to link the
+ *   Qt code with the OpenSSL library (see
+ *   <http://doc.trolltech.com/4.4/gpl.html>). The OpenSSL library is
+ *   licensed under a dual license: the OpenSSL License and the original
+ *   SSLeay license.
+ *
+ * XiVO Client is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with XiVO Client.  If not, see <http://www.gnu.org/licenses/>.
+ */
+
+#ifndef __PEOPLE_SEARCH_CACHE_H__
+#define __PEOPLE_SEARCH_CACHE_H__
+
+#include <QElapsedTimer>
+#include <QHash>
+#include <QString>
+#include <QStringList>
+#include <QVariant>
+
+/*! \brief results of the latest people searches, by pattern
+ *
+ * A pattern that extends a cached one is answered by filtering the cached
+ * results, which are a superset of what the server would return.
+ */
+class PeopleSearchCache
+{
+    public:
+        PeopleSearchCache(int capacity = 20);
+
+        void insert(const QString &pattern, const QVariantList &results);
+        bool lookup(const QString &pattern, QVariantList *results, bool *up_to_date) const;
+        void clear();
+
+        static QString normalized(const QString &pattern);
+
+    private:
+        struct CachedSearch {
+            QVariantList results;
+            QElapsedTimer age;
+        };
+
+        static const int max_age = 60*1000;
+
+        static bool matches(const QVariantMap &result, const QString &pattern);
+        void touch(const QString &pattern) const;
+
+        int m_capacity;
+        QHash<QString, CachedSearch> m_searches;
+        mutable QStringList m_recent_patterns;      //!< most recently used first
+};
+
+#endif
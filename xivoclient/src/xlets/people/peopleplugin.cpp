@@ -39,3 +39,14 @@ XLet * PeoplePlugin::newXLetInstance(QWidget *parent)
     b_engine->registerTranslation(":/obj/people_%1");
     return new People(parent);
 }
+
+QString PeoplePlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/people_%1");
+    return People::tr("People");
+}
+
+QString PeoplePlugin::xletIconPath()
+{
+    return ":/images/tab-people.svg";
+}
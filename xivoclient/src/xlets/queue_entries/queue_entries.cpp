@@ -46,6 +46,12 @@ XLet* QueueEntriesPlugin::newXLetInstance(QWidget *parent)
     return new QueueEntries(parent);
 }
 
+QString QueueEntriesPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/queue_entries_%1");
+    return QueueEntries::tr("Calls of a Queue");
+}
+
 QueueEntries::QueueEntries(QWidget *parent)
     : XLet(parent, tr("Calls of a Queue"))
 {
@@ -68,6 +74,11 @@ QueueEntries::QueueEntries(QWidget *parent)
     QVBoxLayout *layout = new QVBoxLayout(this);
     layout->addWidget(&m_queue_description);
     layout->addWidget(this->m_view);
+
+    if (! b_engine->watchedQueueId().isEmpty()) {
+        this->changeWatchedQueue(b_engine->watchedQueueId());
+        this->m_model->changeWatchedQueue(b_engine->watchedQueueId());
+    }
 }
 
 void QueueEntries::changeWatchedQueue(const QString & queue_id)
@@ -66,10 +66,11 @@ class QueueEntriesPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletqueueentries.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletqueueentries.json")
 
     public:
         XLet *newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
 };
 
 
@@ -43,6 +43,12 @@ XLet* XLetQueueMembersPlugin::newXLetInstance(QWidget *parent)
     return new XletQueueMembers(parent);
 }
 
+QString XLetQueueMembersPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/queue_members_%1");
+    return XletQueueMembers::tr("Queue Members");
+}
+
 XletQueueMembers::XletQueueMembers(QWidget *parent)
     : XLet(parent, tr("Queue Members"))
 {
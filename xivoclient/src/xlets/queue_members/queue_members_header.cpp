@@ -49,13 +49,16 @@ QueueMembersHeader::QueueMembersHeader(QWidget * parent)
 
     connect(b_engine, SIGNAL(changeWatchedQueueSignal(const QString &)),
             this, SLOT(changeWatchedQueue(const QString &)));
-    connect(b_engine, SIGNAL(updateQueueStatus(const QString &)),
+    connect(b_engine, SIGNAL(updateQueueStatus(const QString &, quint32)),
             this, SLOT(updateQueueStatus(const QString &)));
-    connect(b_engine, SIGNAL(updateQueueMemberConfig(const QString &)),
+    connect(b_engine, SIGNAL(updateQueueMemberConfig(const QString &, quint32)),
             this, SLOT(updateQueueMember(const QString &)));
     connect(b_engine, SIGNAL(postRemoveQueueMemberConfig(const QString &)),
             this, SLOT(removeQueueMember(const QString &)));
 
+    if (! b_engine->watchedQueueId().isEmpty()) {
+        this->changeWatchedQueue(b_engine->watchedQueueId());
+    }
 }
 
 void QueueMembersHeader::changeWatchedQueue(const QString & queue_id)
@@ -35,8 +35,6 @@
 #include <storage/queuememberinfo.h>
 #include <storage/userinfo.h>
 #include <dao/queuememberdao.h>
-#include <dao/phonedao.h>
-#include <dao/phonedaoimpl.h>
 
 #include "queue_members_model.h"
 
@@ -46,12 +44,26 @@ QueueMembersModel::QueueMembersModel(QObject *parent)
     : QAbstractTableModel(parent)
 {
     this->fillHeaders();
-    connect(b_engine, SIGNAL(updateQueueMemberConfig(const QString &)),
-            this, SLOT(updateQueueMemberConfig(const QString &)));
+    connect(b_engine, SIGNAL(updateQueueMemberConfigs(const QSet<QString> &, quint32)),
+            this, SLOT(updateQueueMemberConfigs(const QSet<QString> &)));
+    connect(b_engine, SIGNAL(updateAgentStatuses(const QSet<QString> &, quint32)),
+            this, SLOT(updateAgentStatuses(const QSet<QString> &, quint32)));
     connect(b_engine, SIGNAL(removeQueueMemberConfig(const QString &)),
             this, SLOT(removeQueueMemberConfig(const QString &)));
-    connect(b_engine, SIGNAL(updateAgentConfig(const QString &)),
+    connect(b_engine, SIGNAL(updateAgentConfig(const QString &, quint32)),
             this, SLOT(updateAgentConfig(const QString &)));
+    connect(b_engine, SIGNAL(updatePhoneConfig(const QString &, quint32)),
+            this, SLOT(updatePhoneConfig(const QString &)));
+    connect(b_engine, SIGNAL(removePhoneConfig(const QString &)),
+            this, SLOT(updatePhoneConfig(const QString &)));
+    connect(b_engine, SIGNAL(updateUserConfig(const QString &, quint32)),
+            this, SLOT(updateUserConfig(const QString &)));
+
+    // queue members received before the model was created
+    foreach (const QueueMemberInfo *queue_member, b_engine->queuemembers()) {
+        m_id2row[queue_member->xid()] = m_row2id.size();
+        m_row2id.append(queue_member->xid());
+    }
 }
 
 void QueueMembersModel::fillHeaders()
@@ -76,34 +88,109 @@ void QueueMembersModel::fillHeaders()
     m_headers[PENALTY].tooltip = tr("Queue member's penalty");
 }
 
-void QueueMembersModel::updateQueueMemberConfig(const QString &queue_member_id)
+void QueueMembersModel::updateQueueMemberConfigs(const QSet<QString> &queue_member_ids)
 {
-    if (! m_row2id.contains(queue_member_id)) {
-        int insertedRow = m_row2id.size();
-        beginInsertRows(QModelIndex(), insertedRow, insertedRow);
-        m_row2id.append(queue_member_id);
+    QStringList inserted_ids;
+    QStringList updated_ids;
+    foreach (const QString &queue_member_id, queue_member_ids) {
+        m_member_phones.remove(queue_member_id);
+        if (m_id2row.contains(queue_member_id)) {
+            updated_ids.append(queue_member_id);
+        } else if (b_engine->queuemember(queue_member_id) != NULL) {
+            inserted_ids.append(queue_member_id);
+        }
+    }
+
+    if (! inserted_ids.isEmpty()) {
+        int first_inserted_row = m_row2id.size();
+        beginInsertRows(QModelIndex(), first_inserted_row, first_inserted_row + inserted_ids.size() - 1);
+        foreach (const QString &queue_member_id, inserted_ids) {
+            m_id2row[queue_member_id] = m_row2id.size();
+            m_row2id.append(queue_member_id);
+        }
         endInsertRows();
-    } else {
-        this->refreshQueueMemberRow(queue_member_id);
     }
+    this->refreshQueueMemberRows(updated_ids);
+}
+
+/*! \brief refresh the rows of the agents whose queue members changed
+ *
+ * The rows do not show the availability of the agent. The status
+ * changes of the queue members are reported in the FIELD_QUEUES bit of
+ * their agent.
+ */
+void QueueMembersModel::updateAgentStatuses(const QSet<QString> &agent_ids, quint32 fields)
+{
+    if (! (fields & ~(AgentInfo::FIELD_AVAILABILITY | AgentInfo::FIELD_AVAILABILITY_SINCE))) {
+        return;
+    }
+
+    QStringList queue_member_ids;
+    foreach (const QString &agent_id, agent_ids) {
+        queue_member_ids.append(QueueMemberDAO::queueMembersFromAgentId(agent_id));
+    }
+    this->refreshQueueMemberRows(queue_member_ids);
 }
 
 void QueueMembersModel::removeQueueMemberConfig(const QString &xid)
 {
-    if (m_row2id.contains(xid)) {
-        int removedRow = m_row2id.indexOf(xid);
-        removeRow(removedRow);
+    m_member_phones.remove(xid);
+    int removed_row = m_id2row.value(xid, -1);
+    if (removed_row != -1) {
+        removeRow(removed_row);
     }
 }
 
 void QueueMembersModel::updateAgentConfig(const QString & agent_id)
 {
-    QStringList queue_member_ids = QueueMemberDAO::queueMembersFromAgentId(agent_id);
-    foreach (QString queue_member_id, queue_member_ids) {
-        if (m_row2id.contains(queue_member_id)) {
-            this->refreshQueueMemberRow(queue_member_id);
+    this->refreshQueueMemberRows(QueueMemberDAO::queueMembersFromAgentId(agent_id));
+}
+
+void QueueMembersModel::updatePhoneConfig(const QString &phone_xid)
+{
+    // the identity of any phone may now match a member that did not resolve
+    this->refreshMemberPhoneRows(phone_xid, QString());
+    m_member_phones.clear();
+}
+
+void QueueMembersModel::updateUserConfig(const QString &user_xid)
+{
+    this->refreshMemberPhoneRows(QString(), user_xid);
+}
+
+void QueueMembersModel::refreshMemberPhoneRows(const QString &phone_xid, const QString &user_xid)
+{
+    QStringList queue_member_ids;
+    QHash<QString, MemberPhone>::const_iterator it;
+    for (it = m_member_phones.constBegin(); it != m_member_phones.constEnd(); ++it) {
+        const MemberPhone &member_phone = it.value();
+        if ((! phone_xid.isEmpty() && (member_phone.phone_xid == phone_xid || member_phone.phone_xid.isEmpty()))
+            || (! user_xid.isEmpty() && member_phone.user_xid == user_xid)) {
+            queue_member_ids.append(it.key());
         }
     }
+    this->refreshQueueMemberRows(queue_member_ids);
+}
+
+/*! \brief phone and user of a non agent queue member
+ *
+ * Resolved once from the member interface, then kept until the member,
+ * a phone or the user changes.
+ */
+const QueueMembersModel::MemberPhone & QueueMembersModel::memberPhone(const QueueMemberInfo * queue_member) const
+{
+    QHash<QString, MemberPhone>::const_iterator cached = m_member_phones.constFind(queue_member->xid());
+    if (cached != m_member_phones.constEnd()) {
+        return cached.value();
+    }
+
+    MemberPhone member_phone;
+    const PhoneInfo * phone = m_phone_dao.findByIdentity(queue_member->interface());
+    if (phone != NULL) {
+        member_phone.phone_xid = phone->xid();
+        member_phone.user_xid = phone->xid_user_features();
+    }
+    return m_member_phones.insert(queue_member->xid(), member_phone).value();
 }
 
 bool QueueMembersModel::removeRows(int row, int count, const QModelIndex &)
@@ -113,7 +200,13 @@ bool QueueMembersModel::removeRows(int row, int count, const QModelIndex &)
         beginRemoveRows(QModelIndex(), row, row + count - 1);
         for (int i = 0 ; i < count ; i ++) {
             ret = ret && row < m_row2id.size();
-            m_row2id.removeAt(row);
+            if (row < m_row2id.size()) {
+                m_id2row.remove(m_row2id.takeAt(row));
+            }
+        }
+        // following rows moved up
+        for (int i = row ; i < m_row2id.size() ; i ++) {
+            m_id2row[m_row2id[i]] = i;
         }
         endRemoveRows();
     }
@@ -167,14 +260,10 @@ QVariant QueueMembersModel::dataDisplay(int row, int column) const
 
 QVariant QueueMembersModel::phoneDataDisplay(int column, const QueueMemberInfo * queue_member) const
 {
-    PhoneDAO *phone_dao = new PhoneDAOImpl();
-    if (! phone_dao) {
-        return QVariant();
-    }
-    const PhoneInfo * phone = phone_dao->findByIdentity(queue_member->interface());
-    delete phone_dao;
+    const MemberPhone &member_phone = this->memberPhone(queue_member);
+    const PhoneInfo * phone = b_engine->phone(member_phone.phone_xid);
     if (phone == NULL) return QVariant();
-    const UserInfo * user = b_engine->user(phone->xid_user_features());
+    const UserInfo * user = b_engine->user(member_phone.user_xid);
     if (user == NULL) return QVariant();
 
     switch(column) {
@@ -324,12 +413,29 @@ QVariant QueueMembersModel::headerData(int index,
     }
 }
 
-void QueueMembersModel::refreshQueueMemberRow(const QString &queue_member_id)
+/*! \brief emit one dataChanged per run of consecutive rows
+ *
+ * A single range over distant rows would make the views repaint
+ * everything in between.
+ */
+void QueueMembersModel::refreshQueueMemberRows(const QStringList &queue_member_ids)
 {
-    unsigned first_column_index = 0;
-    unsigned last_column_index = NB_COL - 1;
-    unsigned queue_member_row_id = m_row2id.indexOf(queue_member_id);
-    QModelIndex cell_changed_start = createIndex(queue_member_row_id, first_column_index);
-    QModelIndex cell_changed_end = createIndex(queue_member_row_id, last_column_index);
-    emit dataChanged(cell_changed_start, cell_changed_end);
+    QList<int> rows;
+    foreach (const QString &queue_member_id, queue_member_ids) {
+        int row = m_id2row.value(queue_member_id, -1);
+        if (row != -1) {
+            rows.append(row);
+        }
+    }
+    qSort(rows);
+
+    int i = 0;
+    while (i < rows.size()) {
+        int first_row = rows[i];
+        int last_row = first_row;
+        while (++i < rows.size() && rows[i] <= last_row + 1) {
+            last_row = rows[i];
+        }
+        emit dataChanged(createIndex(first_row, 0), createIndex(last_row, NB_COL - 1));
+    }
 }
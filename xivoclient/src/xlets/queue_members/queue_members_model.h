@@ -31,8 +31,11 @@
 #define __QUEUE_MEMBERS_MODEL_H__
 
 #include <QAbstractTableModel>
+#include <QHash>
+#include <QSet>
 #include <QStringList>
 
+#include <dao/phonedaoimpl.h>
 #include <storage/queue_agent_status.h>
 
 class QueueMemberInfo;
@@ -55,12 +58,22 @@ class QueueMembersModel : public QAbstractTableModel
                             int) const;
 
     public slots:
-        void updateQueueMemberConfig(const QString &);
+        void updateQueueMemberConfigs(const QSet<QString> &);
+        void updateAgentStatuses(const QSet<QString> &, quint32 fields);
         void removeQueueMemberConfig(const QString &);
         void updateAgentConfig(const QString &);
+        void updatePhoneConfig(const QString &);
+        void updateUserConfig(const QString &);
 
     private:
-        void refreshQueueMemberRow(const QString &agent_xid);
+        struct MemberPhone {
+            QString phone_xid;
+            QString user_xid;
+        };
+
+        const MemberPhone & memberPhone(const QueueMemberInfo * queue_member) const;
+        void refreshMemberPhoneRows(const QString &phone_xid, const QString &user_xid);
+        void refreshQueueMemberRows(const QStringList &queue_member_ids);
         void fillHeaders();
         QVariant dataDisplay(int row, int column) const;
         QVariant agentDataDisplay(int row, int column, const QueueMemberInfo * queue_member) const;
@@ -94,6 +107,9 @@ class QueueMembersModel : public QAbstractTableModel
 
         HeaderStruct m_headers[NB_COL];
         QStringList m_row2id;
+        QHash<QString, int> m_id2row;  //!< reverse of m_row2id
+        PhoneDAOImpl m_phone_dao;
+        mutable QHash<QString, MemberPhone> m_member_phones; //!< non agent member xid -> resolved phone and user
         static QString not_available ;
 };
 
@@ -37,7 +37,7 @@
 #include "queue_members_model.h"
 
 QueueMembersSortFilterProxyModel::QueueMembersSortFilterProxyModel(QObject *parent)
-    : AbstractSortFilterProxyModel(parent), m_current_queue_id("")
+    : AbstractSortFilterProxyModel(parent), m_current_queue_id(b_engine->watchedQueueId())
 {
     connect(b_engine, SIGNAL(changeWatchedQueueSignal(const QString &)),
             this, SLOT(changeWatchedQueue(const QString &)));
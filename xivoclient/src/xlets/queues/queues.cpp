@@ -50,6 +50,12 @@ XLet* XLetQueuesPlugin::newXLetInstance(QWidget *parent)
     return new XletQueues(parent);
 }
 
+QString XLetQueuesPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/queues_%1");
+    return XletQueues::tr("Queues");
+}
+
 XletQueues::XletQueues(QWidget *parent)
     : XLet(parent, tr("Queues")),
       m_configureWindow(NULL)
@@ -124,6 +130,12 @@ void XletQueues::contextMenuEvent(QContextMenuEvent *event)
         openConfigureWindow();
 }
 
+/*! \brief the periodic stats request was suspended while hidden */
+void XletQueues::resumed()
+{
+    this->askForQueueStats();
+}
+
 void XletQueues::askForQueueStats()
 {
     QVariantMap _for;
@@ -199,13 +211,8 @@ QWidget* XletQueuesConfigure::buildConfigureQueueList(QWidget *parent)
 
     row = 1;
 
-    QHashIterator<QString, XInfo *> i = \
-        QHashIterator<QString, XInfo *>(b_engine->iterover("queues"));
-
-    while (i.hasNext()) {
+    foreach (const QueueInfo *queueinfo, b_engine->queues()) {
         column = 0;
-        i.next();
-        QueueInfo * queueinfo = (QueueInfo *) i.value();
         xqueueid = queueinfo->xid();
 
         displayQueue = new QCheckBox(queueinfo->queueName(), root);
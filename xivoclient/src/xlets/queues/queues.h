@@ -64,6 +64,7 @@ class XletQueues : public XLet, IPBXListener
 
     protected:
         virtual void contextMenuEvent(QContextMenuEvent *);
+        void resumed();
 
     private:
         void openConfigureWindow();
@@ -83,10 +84,11 @@ class XLetQueuesPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletqueues.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletqueues.json")
 
     public:
         XLet *newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
 };
 
 #endif
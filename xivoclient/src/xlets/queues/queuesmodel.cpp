@@ -28,6 +28,8 @@
  */
 
 #include <QBrush>
+#include <QDateTime>
+#include <QTimer>
 
 #include <baseengine.h>
 #include <storage/queueinfo.h>
@@ -35,7 +37,8 @@
 #include "queuesmodel.h"
 
 QueuesModel::QueuesModel(QObject *parent)
-    : QAbstractTableModel(parent)
+    : QAbstractTableModel(parent),
+      m_stats_request_timer(new QTimer(this))
 {
     m_headers[ID].label = "ID";
     m_headers[ID].tooltip = "ID";
@@ -71,13 +74,26 @@ QueuesModel::QueuesModel(QObject *parent)
     m_headers[QOS].tooltip = tr("Ratio (Calls answered in less than X sec / "
                                  "Number of calls answered)");
 
-    connect(b_engine, SIGNAL(updateQueueConfig(const QString &)),
+    connect(b_engine, SIGNAL(updateQueueConfig(const QString &, quint32)),
             this, SLOT(updateQueueConfig(const QString &)));
     connect(b_engine, SIGNAL(removeQueueConfig(const QString &)),
             this, SLOT(removeQueueConfig(const QString &)));
     // In case the option "show queue numbers" is toggled
     connect(b_engine, SIGNAL(settingsChanged()),
             this, SLOT(updateQueueNames()));
+
+    m_stats_request_timer->setSingleShot(true);
+    m_stats_request_timer->setInterval(500);
+    connect(m_stats_request_timer, SIGNAL(timeout()),
+            this, SIGNAL(askForQueueStats()));
+
+    // queues received before the model was created
+    foreach (const QueueInfo *queue, b_engine->queues()) {
+        m_row2id.append(queue->xid());
+    }
+    if (! m_row2id.isEmpty()) {
+        m_stats_request_timer->start();
+    }
 }
 
 void QueuesModel::updateQueueConfig(const QString &xid)
@@ -88,10 +104,10 @@ void QueuesModel::updateQueueConfig(const QString &xid)
         m_row2id.append(xid);
         endInsertRows();
 
-        /* Ask for stats once now, to avoid waiting the first update (default
-         * is 30s)
+        /* Ask for stats soon, to avoid waiting the first update (default
+         * is 30s), but only once for all the queues of the bootstrap
          */
-        emit askForQueueStats();
+        m_stats_request_timer->start();
     } else {
         QModelIndex cellChanged = createIndex(m_row2id.indexOf(xid), NAME);
         // sends signal to proxy/view that the data should be refreshed
@@ -107,27 +123,26 @@ void QueuesModel::removeQueueConfig(const QString &xid)
     }
 }
 
-/*! \brief Increase max waiting times of one second and tells the view to
- * refresh
+/*! \brief Tells the view to refresh the longest wait of the queues with
+ * waiting calls
  */
 void QueuesModel::increaseWaitTime()
 {
-    foreach(QString xqueueid, m_queues_data.keys()) {
-        // Do not update if no one is waiting in the queue
-        if (m_queues_data[xqueueid].stats.value("Xivo-WaitingCalls",0).toInt() > 0) {
-            unsigned nsecs = m_queues_data[xqueueid].stats["Xivo-LongestWaitTime"].toInt();
-            nsecs++;
-            m_queues_data[xqueueid].stats["Xivo-LongestWaitTime"] = QString("%1").arg(nsecs);
+    int first_row = -1;
+    for (int row = 0; row <= m_row2id.size(); row++) {
+        bool waiting = false;
+        if (row < m_row2id.size()) {
+            QHash<QString, QueueStats>::const_iterator stats = m_queues_stats.constFind(m_row2id[row]);
+            waiting = stats != m_queues_stats.constEnd() && stats.value().waiting_calls.value > 0;
         }
-        else {
-            m_queues_data[xqueueid].stats["Xivo-LongestWaitTime"] = "0";
+        if (waiting && first_row == -1) {
+            first_row = row;
+        } else if (! waiting && first_row != -1) {
+            // sends signal to proxy/view that the data should be refreshed
+            emit dataChanged(createIndex(first_row, CURRENT_MAX_WAIT), createIndex(row - 1, CURRENT_MAX_WAIT));
+            first_row = -1;
         }
     }
-
-    QModelIndex cellChanged1 = createIndex(0, CURRENT_MAX_WAIT);
-    QModelIndex cellChanged2 = createIndex(m_row2id.size() - 1, CURRENT_MAX_WAIT);
-    // sends signal to proxy/view that the data should be refreshed
-    emit dataChanged(cellChanged1, cellChanged2);
 }
 
 /*! \brief Tells the view that the queue names should be refreshed
@@ -165,36 +180,108 @@ int QueuesModel::columnCount(const QModelIndex&) const
     return NB_COL;
 }
 
-QVariant QueuesModel::formatPercent(const QVariant &data) const
+void QueuesModel::StatValue::parse(const QString &field)
 {
-    QString value = data.toString();
-    if (value.isEmpty()) {
-        return "-";
+    bool is_int;
+    int number = field.toInt(&is_int);
+    text.clear();
+    if (field.isEmpty()) {
+        state = Empty;
+    } else if (is_int) {
+        state = Number;
+        value = number;
     } else {
-        bool data_is_int;
-        data.toInt(&data_is_int);
-        if (!data_is_int) {
-            return data;
-        } else {
-            return QString("%0 %").arg(value);
-        }
+        state = Text;
+        text = field;
+    }
+    if (state != Number) {
+        value = 0;
     }
 }
 
-QVariant QueuesModel::formatTime(const QVariant &data) const
+QVariant QueuesModel::rawValue(const StatValue &stat, const QVariant &missing) const
 {
-    QString value = data.toString();
-    if (value.isEmpty()) {
+    switch (stat.state) {
+    case StatValue::Missing:
+        return missing;
+    case StatValue::Number:
+        return stat.value;
+    case StatValue::Text:
+        return stat.text;
+    default:
+        return QString("");
+    }
+}
+
+QVariant QueuesModel::formatPercent(const StatValue &stat, const QVariant &missing) const
+{
+    switch (stat.state) {
+    case StatValue::Missing:
+        return missing;
+    case StatValue::Empty:
+        return "-";
+    case StatValue::Number:
+        return QString("%0 %").arg(stat.value);
+    default:
+        return stat.text;
+    }
+}
+
+QVariant QueuesModel::formatTime(const StatValue &stat, const QVariant &missing) const
+{
+    switch (stat.state) {
+    case StatValue::Missing:
+        return missing;
+    case StatValue::Empty:
         return "-";
+    case StatValue::Number:
+        return QTime(0, 0).addSecs(stat.value).toString("mm:ss");
+    default:
+        return stat.text;
+    }
+}
+
+/*! \brief the longest wait, as of now */
+QueuesModel::StatValue QueuesModel::longestWait(const QueueStats &stats) const
+{
+    if (stats.longest_wait.state != StatValue::Number) {
+        return stats.longest_wait;
+    }
+
+    StatValue longest_wait = stats.longest_wait;
+    if (stats.waiting_calls.value > 0) {
+        longest_wait.value = (QDateTime::currentMSecsSinceEpoch() - stats.longest_wait_start) / 1000;
     } else {
-        bool data_is_int;
-        unsigned nsecs = data.toInt(&data_is_int);
-        if (!data_is_int) {
-            return data;
-        } else {
-            return QTime(0, 0).addSecs(nsecs).toString("mm:ss");
-        }
+        longest_wait.value = 0;
+    }
+    return longest_wait;
+}
+
+QueuesModel::StatValue * QueuesModel::statField(QueueStats &stats, const QString &stat_name)
+{
+    typedef StatValue QueueStats::*StatMember;
+    static QHash<QString, StatMember> stat_members;
+    if (stat_members.isEmpty()) {
+        stat_members["Xivo-WaitingCalls"] = &QueueStats::waiting_calls;
+        stat_members["Xivo-EWT"] = &QueueStats::ewt;
+        stat_members["Xivo-LongestWaitTime"] = &QueueStats::longest_wait;
+        stat_members["Xivo-LoggedAgents"] = &QueueStats::logged_agents;
+        stat_members["Xivo-AvailableAgents"] = &QueueStats::available_agents;
+        stat_members["Xivo-TalkingAgents"] = &QueueStats::talking_agents;
+        stat_members["Xivo-Join"] = &QueueStats::received;
+        stat_members["Xivo-Link"] = &QueueStats::answered;
+        stat_members["Xivo-Lost"] = &QueueStats::abandoned;
+        stat_members["Xivo-Holdtime-avg"] = &QueueStats::mean_wait;
+        stat_members["Xivo-Holdtime-max"] = &QueueStats::max_wait;
+        stat_members["Xivo-Rate"] = &QueueStats::efficiency;
+        stat_members["Xivo-Qos"] = &QueueStats::qos;
+    }
+
+    StatMember member = stat_members.value(stat_name, NULL);
+    if (member == NULL) {
+        return NULL;
     }
+    return &(stats.*member);
 }
 
 QVariant QueuesModel::data(const QModelIndex &index, int role) const
@@ -219,10 +306,9 @@ QVariant QueuesModel::data(const QModelIndex &index, int role) const
     const QueueInfo * queueinfo = b_engine->queue(xqueueid);
     if (queueinfo == NULL) return QVariant();
 
-    QueueDataStruct queue_data;
-    if (m_queues_data.contains(xqueueid)) {
-        queue_data = m_queues_data.value(xqueueid);
-    }
+    static const QueueStats no_stats;
+    QHash<QString, QueueStats>::const_iterator found_stats = m_queues_stats.constFind(xqueueid);
+    const QueueStats &stats = found_stats != m_queues_stats.constEnd() ? found_stats.value() : no_stats;
 
     // Background color
     if (role == Qt::BackgroundRole) {
@@ -231,12 +317,12 @@ QVariant QueuesModel::data(const QModelIndex &index, int role) const
             case WAITING_CALLS :
                 greenlevel = b_engine->getConfig("guioptions.queuelevels").toMap().value("green").toUInt() - 1;
                 orangelevel = b_engine->getConfig("guioptions.queuelevels").toMap().value("orange").toUInt() - 1;
-                value = queue_data.stats.value("Xivo-WaitingCalls").toInt();
+                value = stats.waiting_calls.value;
                 break ;
             case CURRENT_MAX_WAIT :
                 greenlevel = b_engine->getConfig("guioptions.queuelevels_wait").toMap().value("green").toUInt() - 1;
                 orangelevel = b_engine->getConfig("guioptions.queuelevels_wait").toMap().value("orange").toUInt() - 1;
-                value = queue_data.stats.value("Xivo-LongestWaitTime").toInt();
+                value = this->longestWait(stats).value;
                 break ;
             default :
                 return QVariant();
@@ -264,31 +350,31 @@ QVariant QueuesModel::data(const QModelIndex &index, int role) const
             case NAME :
                 return queueinfo->queueDisplayName();
             case WAITING_CALLS :
-                return queue_data.stats.value("Xivo-WaitingCalls", "--");
+                return rawValue(stats.waiting_calls, "--");
             case EWT :
-                return formatTime(queue_data.stats.value("Xivo-EWT", not_available));
+                return formatTime(stats.ewt, not_available);
             case CURRENT_MAX_WAIT :
-                return formatTime(queue_data.stats.value("Xivo-LongestWaitTime", not_available));
+                return formatTime(this->longestWait(stats), not_available);
             case LOGGEDAGENTS:
-                return queue_data.stats.value("Xivo-LoggedAgents", not_available);
+                return rawValue(stats.logged_agents, not_available);
             case AVAILABLE_AGENTS:
-                return queue_data.stats.value("Xivo-AvailableAgents", not_available);
+                return rawValue(stats.available_agents, not_available);
             case TALKING_AGENTS:
-                return queue_data.stats.value("Xivo-TalkingAgents", not_available);
+                return rawValue(stats.talking_agents, not_available);
             case RECEIVED :
-                return queue_data.stats.value("Xivo-Join", not_available);
+                return rawValue(stats.received, not_available);
             case ANSWERED :
-                return queue_data.stats.value("Xivo-Link", not_available);
+                return rawValue(stats.answered, not_available);
             case ABANDONED :
-                return queue_data.stats.value("Xivo-Lost", not_available);
+                return rawValue(stats.abandoned, not_available);
             case MEAN_WAIT :
-                return formatTime(queue_data.stats.value("Xivo-Holdtime-avg", not_available));
+                return formatTime(stats.mean_wait, not_available);
             case TOTAL_MAX_WAIT :
-                return formatTime(queue_data.stats.value("Xivo-Holdtime-max", not_available));
+                return formatTime(stats.max_wait, not_available);
             case EFFICIENCY :
-                return formatPercent(queue_data.stats.value("Xivo-Rate", not_available));
+                return formatPercent(stats.efficiency, not_available);
             case QOS :
-                return formatPercent(queue_data.stats.value("Xivo-Qos", not_available));
+                return formatPercent(stats.qos, not_available);
             default :
                 return not_available;
         }
@@ -320,23 +406,35 @@ QVariant QueuesModel::headerData(int section,
  */
 void QueuesModel::eatQueuesStats(const QVariantMap &p)
 {
+    int first_row = m_row2id.size();
+    int last_row = -1;
     foreach (QString queueid, p.value("stats").toMap().keys()) {
         QString xqueueid = QString("%0/%1").arg(b_engine->ipbxid()).arg(queueid);
         QVariantMap qvm = p.value("stats").toMap().value(queueid).toMap();
-        foreach (QString stat_name, qvm.keys()) {
-            QString field = qvm.value(stat_name).toString();
-            m_queues_data[xqueueid].stats[stat_name] = field;
+        QueueStats &stats = m_queues_stats[xqueueid];
+        for (QVariantMap::const_iterator it = qvm.constBegin(); it != qvm.constEnd(); ++it) {
+            StatValue *stat = statField(stats, it.key());
+            if (stat != NULL) {
+                stat->parse(it.value().toString());
+            }
+        }
+        if (qvm.contains("Xivo-LongestWaitTime")) {
+            stats.longest_wait_start = QDateTime::currentMSecsSinceEpoch() - qint64(stats.longest_wait.value) * 1000;
+        }
+        int row = m_row2id.indexOf(xqueueid);
+        if (row != -1) {
+            first_row = qMin(first_row, row);
+            last_row = qMax(last_row, row);
         }
-        refreshQueueDisplay(xqueueid);
     }
-}
+    if (last_row == -1) {
+        return;
+    }
 
-void QueuesModel::refreshQueueDisplay(const QString &queue_xid)
-{
-    QModelIndex cellChanged1 = createIndex(m_row2id.indexOf(queue_xid), ID);
-    QModelIndex cellChanged2 = createIndex(m_row2id.indexOf(queue_xid), QOS);
+    // one refresh for every queue of the message
+    QModelIndex cellChanged1 = createIndex(first_row, ID);
+    QModelIndex cellChanged2 = createIndex(last_row, QOS);
     emit dataChanged(cellChanged1, cellChanged2);
-
 }
 
 Qt::ItemFlags QueuesModel::flags(const QModelIndex &index) const
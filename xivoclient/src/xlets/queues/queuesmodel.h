@@ -31,18 +31,20 @@
 #define __QUEUESMODEL_H__
 
 #include <QAbstractTableModel>
+#include <QHash>
 #include <QStringList>
 
+class QTimer;
+
 /*! \brief Queues model.
  *
  * Infos come mainly from BaseEngine.
  *
  * m_row2id maps row numbers to queue ids. It is an ordered QStringList.
  *
- * Exceptions are (see QueueDataStruct):
- * - max waiting times, one for each queue, computed on each updateStatus
- * - waiting calls, cached from BaseEngine (used in the computation of the max
- *   waiting time
+ * Exceptions are (see QueueStats):
+ * - max waiting times, one for each queue, derived from the time the longest
+ *   waiting call started waiting
  * - stats, fetched from the server and stored here (plugin-only info, should
  *   not be in BaseEngine
  */
@@ -76,9 +78,14 @@ class QueuesModel : public QAbstractTableModel
         virtual Qt::ItemFlags flags(const QModelIndex &index) const;
 
     private:
-        QVariant formatTime(const QVariant &) const;
-        QVariant formatPercent(const QVariant &) const;
-        void refreshQueueDisplay(const QString &queue_xid);
+        struct StatValue;
+        struct QueueStats;
+
+        QVariant rawValue(const StatValue &, const QVariant &missing) const;
+        QVariant formatTime(const StatValue &, const QVariant &missing) const;
+        QVariant formatPercent(const StatValue &, const QVariant &missing) const;
+        StatValue longestWait(const QueueStats &) const;
+        static StatValue * statField(QueueStats &stats, const QString &stat_name);
     // Attributes
     public:
         enum Columns {
@@ -111,13 +118,44 @@ class QueuesModel : public QAbstractTableModel
             QString tooltip;
         };
 
-        struct QueueDataStruct {
-            QMap<QString, QString> stats;
+        /*! \brief One statistic as sent by the server */
+        struct StatValue {
+            StatValue() : state(Missing), value(0) {}
+            void parse(const QString &field);
+
+            enum State {
+                Missing,    //!< never received
+                Empty,      //!< received empty
+                Number,     //!< received as an integer, in value
+                Text        //!< received as anything else, in text
+            } state;
+            int value;
+            QString text;
+        };
+
+        struct QueueStats {
+            QueueStats() : longest_wait_start(0) {}
+
+            StatValue waiting_calls;
+            StatValue ewt;
+            StatValue longest_wait;             //!< as received, see longest_wait_start
+            qint64 longest_wait_start;          //!< msecs since epoch when the longest waiting call started waiting
+            StatValue logged_agents;
+            StatValue available_agents;
+            StatValue talking_agents;
+            StatValue received;
+            StatValue answered;
+            StatValue abandoned;
+            StatValue mean_wait;
+            StatValue max_wait;
+            StatValue efficiency;
+            StatValue qos;
         };
 
         HeaderStruct m_headers[NB_COL];
         QStringList m_row2id;
-        QMap<QString, QueueDataStruct> m_queues_data;
+        QHash<QString, QueueStats> m_queues_stats;
+        QTimer *m_stats_request_timer;          //!< asks for stats once new queues stopped coming
 };
 
 #endif
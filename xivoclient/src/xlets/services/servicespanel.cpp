@@ -37,6 +37,17 @@ XLet* XLetServicesPlugin::newXLetInstance(QWidget *parent)
     return new ServicesPanel(parent);
 }
 
+QString XLetServicesPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/services_%1");
+    return ServicesPanel::tr("Services");
+}
+
+QString XLetServicesPlugin::xletIconPath()
+{
+    return ":/images/tab-services.svg";
+}
+
 ServicesPanel::ServicesPanel(QWidget * parent)
     : XLet(parent, tr("Services"), ":/images/tab-services.svg"),
       m_nofwd_sent(false)
@@ -80,8 +91,13 @@ ServicesPanel::ServicesPanel(QWidget * parent)
     this->ui.fwdbusy_button->hide();
     this->ui.fwdunc_button->hide();
 
-    connect(b_engine, SIGNAL(updateUserConfig(const QString &, const QVariantMap &)),
-            this, SLOT(updateUserConfig(const QString &, const QVariantMap &)));
+    b_engine->updateRouter().subscribe("users", UpdateRouter::CONFIG, m_xuserid,
+                                       this, SLOT(updateUserConfig(const QString &, const QVariantMap &)));
+
+    // the user is already known when the xlet is spawned after login
+    if (m_ui != NULL) {
+        this->refreshServices(NULL);
+    }
 }
 
 void ServicesPanel::on_call_filtering_checkbox_stateChanged(int state)
@@ -221,74 +237,88 @@ void ServicesPanel::toggledSimpleFwd(bool checked)
     this->ui.fwdsimple_radiobutton->setChecked(checked);
 }
 
-void ServicesPanel::updateUserConfig(const QString & xuserid, const QVariantMap & datamap)
+static bool hasChanged(const QVariantMap *changed, const char *key)
+{
+    return changed == NULL || changed->contains(key);
+}
+
+void ServicesPanel::updateUserConfig(const QString & xuserid, const QVariantMap & config)
 {
     if (xuserid == m_xuserid) {
-        QVariantMap deltaConfig = datamap["config"].toMap();
-
-        this->ui.call_filtering_checkbox->blockSignals(true);
-        this->ui.dnd_checkbox->blockSignals(true);
-        this->ui.nofwd_radiobutton->blockSignals(true);
-        this->ui.fwdunc_radiobutton->blockSignals(true);
-        this->ui.fwdsimple_radiobutton->blockSignals(true);
-        this->ui.fwdna_checkbox->blockSignals(true);
-        this->ui.fwdbusy_checkbox->blockSignals(true);
-
-        if (deltaConfig.keys().contains("incallfilter")) {
-            this->ui.call_filtering_checkbox->setChecked(m_ui->incallfilter());
-        }
-
-        if (deltaConfig.keys().contains("enablednd")) {
-            this->ui.dnd_checkbox->setChecked(m_ui->enablednd());
-        }
-
-        CallForwardStruct call_fwdunc = {m_ui->enableunc(), m_ui->destunc()};
-        CallForwardStruct call_fwdna = {m_ui->enablerna(), m_ui->destrna()};
-        CallForwardStruct call_fwdbusy = {m_ui->enablebusy(), m_ui->destbusy()};
-
-        if (deltaConfig.keys().contains("enableunc")
-            || deltaConfig.keys().contains("destunc")) {
-
-            this->ui.fwdunc_input->setText(call_fwdunc.destination);
-        }
-
-        if (deltaConfig.keys().contains("enablerna")
-            || deltaConfig.keys().contains("destrna")) {
-
-            this->ui.fwdna_input->setText(call_fwdna.destination);
-            this->ui.fwdna_checkbox->setChecked(call_fwdna.enabled);
-        }
-
-        if (deltaConfig.keys().contains("enablebusy")
-            || deltaConfig.keys().contains("destbusy")) {
-
-            this->ui.fwdbusy_input->setText(call_fwdbusy.destination);
-            this->ui.fwdbusy_checkbox->setChecked(call_fwdbusy.enabled);
-        }
-
-        // Activate the right radiobutton
-        if (m_nofwd_sent) {
-            this->ui.nofwd_radiobutton->setChecked(true);
-        } else if (call_fwdunc.enabled) {
-            this->toggledSimpleFwd(false);
-            this->ui.fwdunc_radiobutton->setChecked(true);
-        } else if (call_fwdna.enabled || call_fwdbusy.enabled) {
-            this->toggledSimpleFwd(true);
-        } else if (this->ui.fwdunc_radiobutton->isChecked()) {
-            this->ui.nofwd_radiobutton->setChecked(true);
-        }
-
-        if (m_nofwd_sent && ! call_fwdunc.enabled && ! call_fwdna.enabled
-            && ! call_fwdbusy.enabled) {
-            m_nofwd_sent = false;
-        }
-
-        this->ui.call_filtering_checkbox->blockSignals(false);
-        this->ui.dnd_checkbox->blockSignals(false);
-        this->ui.nofwd_radiobutton->blockSignals(false);
-        this->ui.fwdunc_radiobutton->blockSignals(false);
-        this->ui.fwdsimple_radiobutton->blockSignals(false);
-        this->ui.fwdna_checkbox->blockSignals(false);
-        this->ui.fwdbusy_checkbox->blockSignals(false);
+        this->refreshServices(&config);
+    }
+}
+
+/*! \brief show the services of the user
+ *
+ * Only the services with a key in changed are refreshed, not to overwrite
+ * what is being typed in the other inputs. All of them are refreshed
+ * when changed is NULL.
+ */
+void ServicesPanel::refreshServices(const QVariantMap *changed)
+{
+    this->ui.call_filtering_checkbox->blockSignals(true);
+    this->ui.dnd_checkbox->blockSignals(true);
+    this->ui.nofwd_radiobutton->blockSignals(true);
+    this->ui.fwdunc_radiobutton->blockSignals(true);
+    this->ui.fwdsimple_radiobutton->blockSignals(true);
+    this->ui.fwdna_checkbox->blockSignals(true);
+    this->ui.fwdbusy_checkbox->blockSignals(true);
+
+    if (hasChanged(changed, "incallfilter")) {
+        this->ui.call_filtering_checkbox->setChecked(m_ui->incallfilter());
     }
+
+    if (hasChanged(changed, "enablednd")) {
+        this->ui.dnd_checkbox->setChecked(m_ui->enablednd());
+    }
+
+    CallForwardStruct call_fwdunc = {m_ui->enableunc(), m_ui->destunc()};
+    CallForwardStruct call_fwdna = {m_ui->enablerna(), m_ui->destrna()};
+    CallForwardStruct call_fwdbusy = {m_ui->enablebusy(), m_ui->destbusy()};
+
+    if (hasChanged(changed, "enableunc")
+        || hasChanged(changed, "destunc")) {
+
+        this->ui.fwdunc_input->setText(call_fwdunc.destination);
+    }
+
+    if (hasChanged(changed, "enablerna")
+        || hasChanged(changed, "destrna")) {
+
+        this->ui.fwdna_input->setText(call_fwdna.destination);
+        this->ui.fwdna_checkbox->setChecked(call_fwdna.enabled);
+    }
+
+    if (hasChanged(changed, "enablebusy")
+        || hasChanged(changed, "destbusy")) {
+
+        this->ui.fwdbusy_input->setText(call_fwdbusy.destination);
+        this->ui.fwdbusy_checkbox->setChecked(call_fwdbusy.enabled);
+    }
+
+    // Activate the right radiobutton
+    if (m_nofwd_sent) {
+        this->ui.nofwd_radiobutton->setChecked(true);
+    } else if (call_fwdunc.enabled) {
+        this->toggledSimpleFwd(false);
+        this->ui.fwdunc_radiobutton->setChecked(true);
+    } else if (call_fwdna.enabled || call_fwdbusy.enabled) {
+        this->toggledSimpleFwd(true);
+    } else if (this->ui.fwdunc_radiobutton->isChecked()) {
+        this->ui.nofwd_radiobutton->setChecked(true);
+    }
+
+    if (m_nofwd_sent && ! call_fwdunc.enabled && ! call_fwdna.enabled
+        && ! call_fwdbusy.enabled) {
+        m_nofwd_sent = false;
+    }
+
+    this->ui.call_filtering_checkbox->blockSignals(false);
+    this->ui.dnd_checkbox->blockSignals(false);
+    this->ui.nofwd_radiobutton->blockSignals(false);
+    this->ui.fwdunc_radiobutton->blockSignals(false);
+    this->ui.fwdsimple_radiobutton->blockSignals(false);
+    this->ui.fwdna_checkbox->blockSignals(false);
+    this->ui.fwdbusy_checkbox->blockSignals(false);
 }
@@ -70,6 +70,7 @@ class ServicesPanel : public XLet
         void on_fwdbusy_input_editingFinished();
 
     private:
+        void refreshServices(const QVariantMap *changed);
         void toggledSimpleFwd(bool checked);
         void sendSetUnconditionalForward(bool checked);
         void sendSetForwardNoAnswer(bool checked);
@@ -83,10 +84,12 @@ class XLetServicesPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletservices.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletservices.json")
 
     public:
         XLet* newXLetInstance(QWidget *parent=0);
+        QString xletTitle();
+        QString xletIconPath();
 };
 
 #endif
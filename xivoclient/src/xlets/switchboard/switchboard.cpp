@@ -95,6 +95,10 @@ Switchboard::Switchboard(QWidget *parent)
     connect(this, SIGNAL(dialSuccess()),
             this->m_current_call, SLOT(dialSuccess()));
 
+    if (b_engine->isInitialized()) {
+        this->postInitializationSetup();
+    }
+
     this->setFocus();
 }
 
@@ -170,7 +174,7 @@ QString Switchboard::updatePhoneHintStatus()
 
 void Switchboard::connectPhoneStatus() const
 {
-    connect(b_engine, SIGNAL(updatePhoneStatus(const QString &)),
+    connect(b_engine, SIGNAL(updatePhoneStatus(const QString &, quint32)),
             this, SLOT(updatePhoneStatus(const QString &)));
 }
 
@@ -39,3 +39,9 @@ XLet * SwitchboardPlugin::newXLetInstance(QWidget *parent)
     b_engine->registerTranslation(":/obj/switchboard_%1");
     return new Switchboard(parent);
 }
+
+QString SwitchboardPlugin::xletTitle()
+{
+    b_engine->registerTranslation(":/obj/switchboard_%1");
+    return Switchboard::tr("Switchboard");
+}
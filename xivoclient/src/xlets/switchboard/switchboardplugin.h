@@ -39,10 +39,11 @@ class SwitchboardPlugin : public QObject, XLetInterface
 {
     Q_OBJECT
     Q_INTERFACES(XLetInterface)
-    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.2" FILE "xletswitchboard.json")
+    Q_PLUGIN_METADATA(IID "com.avencall.Plugin.XLetInterface/1.3" FILE "xletswitchboard.json")
 
 public:
     XLet *newXLetInstance(QWidget *parent=0);
+    QString xletTitle();
 };
 
 #endif
@@ -1,3 +1,4 @@
 TEMPLATE = subdirs
 SUBDIRS  = \
     src/xletlib/tests/ \
+    src/xlets/agent_status_dashboard/tests/ \